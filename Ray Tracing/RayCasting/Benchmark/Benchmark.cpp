@@ -0,0 +1,324 @@
+#include <Scenes.h>
+#include <Geometry/Scene.h>
+#include <System/Profiler.h>
+#include <System/RayStatistics.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief	Benchmark of the built-in scenes (see Scenes). Each scene is rendered headless at a fixed
+/// 		resolution, depth and number of samples, once to count the rays and build the hierarchies,
+/// 		then for a number of timed iterations. The scenes without emissive objects get the area
+/// 		lights of Scenes::initAreaLights, so that every scene renders an image with the global
+/// 		illumination integrators. The renderings are deterministic: the random generators only
+/// 		depend on the pixel, the sample and the seed (see Scene::setSeed), not on the threads. The
+/// 		image of the last iteration is compared with a reference image (written with --update), so
+/// 		that an optimization can be validated for both speed and correctness. Each integrator has
+/// 		its own references: the path tracing ones are in the pathtracing subdirectory.
+///
+/// 		Usage: Benchmark [--scene name]... [--width n] [--height n] [--depth n] [--rays n]
+/// 		[--iterations n] [--threads n] [--seed n] [--pathtracing] [--references directory]
+/// 		[--update] [--min-psnr dB]
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+	/// \brief	A built-in scene of the benchmark.
+	struct BenchmarkScene
+	{
+		/// \brief	The name of the scene (and of its reference image).
+		const char * m_name;
+		/// \brief	Adds the geometry of the scene.
+		void (*m_init)(Geometry::Scene &);
+		/// \brief	Does the scene have emissive objects (area lights are added otherwise)?
+		bool m_emissive;
+	};
+
+	/// \brief	The scenes of the benchmark.
+	const BenchmarkScene s_scenes[] =
+	{
+		{ "diffuse", Scenes::initDiffuse, false },
+		{ "specular", Scenes::initSpecular, false },
+		{ "diffuseSpecular", Scenes::initDiffuseSpecular, false },
+		{ "refraction", Scenes::initRefraction, false },
+		{ "emissive", Scenes::initEmissive, true }
+	};
+
+	/// \brief	Number of scenes of the benchmark.
+	const int s_sceneCount = (int)(sizeof(s_scenes)/sizeof(s_scenes[0]));
+
+	/// \brief	The parameters of the benchmark.
+	struct Options
+	{
+		/// \brief	The scenes to render (all if empty).
+		::std::vector<::std::string> m_scenes;
+		/// \brief	The size of the images.
+		int m_width, m_height;
+		/// \brief	The parameters of Scene::compute.
+		int m_maxDepth, m_nbRandomRay;
+		/// \brief	The number of timed renderings of each scene.
+		int m_iterations;
+		/// \brief	The number of rendering threads (0: all the cores).
+		int m_threads;
+		/// \brief	The seed of the renderings (see Scene::setSeed).
+		unsigned int m_seed;
+		/// \brief	Renders with the path tracing integrator instead of the recursive one.
+		bool m_pathTracing;
+		/// \brief	The directory of the reference images (of the recursive integrator, the ones of the
+		/// 		path tracing integrator are in its pathtracing subdirectory).
+		::std::string m_references;
+		/// \brief	Writes the reference images instead of comparing with them.
+		bool m_update;
+		/// \brief	The minimum PSNR of an image with respect to its reference.
+		double m_minPSNR;
+
+		Options()
+			: m_width(128), m_height(128), m_maxDepth(1), m_nbRandomRay(16), m_iterations(10), m_threads(0), m_seed(0), m_pathTracing(false), m_references("References"), m_update(false), m_minPSNR(40.0)
+		{}
+	};
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \fn	bool parseOptions(int argc, char ** argv, Options & options)
+	///
+	/// \brief	Parses the command line.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	///
+	/// \param	argc			Number of command-line arguments.
+	/// \param	argv			Array of command-line argument strings.
+	/// \param [out]	options	The parameters of the benchmark.
+	///
+	/// \return	false if the command line is invalid.
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	bool parseOptions(int argc, char ** argv, Options & options)
+	{
+		for(int i = 1; i < argc; i++)
+		{
+			::std::string option = argv[i];
+			if(option == "--pathtracing")
+				options.m_pathTracing = true;
+			else if(option == "--update")
+				options.m_update = true;
+			else if(i + 1 >= argc)
+				return false;
+			else if(option == "--scene")
+				options.m_scenes.push_back(argv[++i]);
+			else if(option == "--references")
+				options.m_references = argv[++i];
+			else if(option == "--min-psnr")
+				options.m_minPSNR = atof(argv[++i]);
+			else if(option == "--seed")
+				options.m_seed = (unsigned int)strtoul(argv[++i], NULL, 10);
+			else
+			{
+				int value = atoi(argv[++i]);
+				if(option == "--width") options.m_width = value;
+				else if(option == "--height") options.m_height = value;
+				else if(option == "--depth") options.m_maxDepth = value;
+				else if(option == "--rays") options.m_nbRandomRay = value;
+				else if(option == "--iterations") options.m_iterations = value;
+				else if(option == "--threads") options.m_threads = value;
+				else return false;
+			}
+		}
+		for(int i = 0; i < (int)options.m_scenes.size(); i++)
+		{
+			bool found = false;
+			for(int j = 0; j < s_sceneCount; j++)
+				found = found || options.m_scenes[i] == s_scenes[j].m_name;
+			if(!found)
+			{
+				::std::cerr<<"Unknown scene "<<options.m_scenes[i]<<::std::endl;
+				return false;
+			}
+		}
+		return options.m_width > 0 && options.m_height > 0 && options.m_iterations > 0;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \fn	bool readPPM(std::string const & fileName, int & width, int & height, std::vector<unsigned char> & rgb)
+	///
+	/// \brief	Reads a binary PPM file with 8 bits components (as written by Framebuffer::writePPM).
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	///
+	/// \param	fileName		The name of the file.
+	/// \param [out]	width 	The width of the image.
+	/// \param [out]	height	The height of the image.
+	/// \param [out]	rgb   	The components of the pixels, row by row.
+	///
+	/// \return	false if the file cannot be read.
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	bool readPPM(::std::string const & fileName, int & width, int & height, ::std::vector<unsigned char> & rgb)
+	{
+		FILE * file = fopen(fileName.c_str(), "rb");
+		if(file == NULL)
+			return false;
+		int maxValue = 0;
+		bool valid = fscanf(file, "P6 %d %d %d", &width, &height, &maxValue) == 3 && maxValue == 255 && width > 0 && height > 0 && fgetc(file) != EOF;
+		if(valid)
+		{
+			rgb.resize((size_t)3*width*height);
+			valid = fread(&rgb[0], 1, rgb.size(), file) == rgb.size();
+		}
+		fclose(file);
+		return valid;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \fn	double rootMeanSquareError(std::vector<unsigned char> const & image, std::vector<unsigned char> const & reference)
+	///
+	/// \brief	Root mean square difference of the components of two images of the same size.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	///
+	/// \param	image	 	The image.
+	/// \param	reference	The reference image.
+	///
+	/// \return	The error in levels (0 to 255).
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	double rootMeanSquareError(::std::vector<unsigned char> const & image, ::std::vector<unsigned char> const & reference)
+	{
+		double sum = 0.0;
+		for(size_t i = 0; i < image.size(); i++)
+		{
+			double difference = (double)image[i] - (double)reference[i];
+			sum += difference*difference;
+		}
+		return image.empty() ? 0.0 : sqrt(sum/image.size());
+	}
+
+	/// \brief	The value below which a given fraction of the sorted values lie (nearest rank).
+	double percentile(::std::vector<double> const & sorted, double fraction)
+	{
+		int rank = (int)ceil(fraction*sorted.size());
+		return sorted[::std::min(::std::max(rank, 1), (int)sorted.size()) - 1];
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \fn	bool runScene(BenchmarkScene const & description, Options const & options)
+	///
+	/// \brief	Benchmarks a scene and prints its line of the report.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	///
+	/// \param	description	The scene.
+	/// \param	options	   	The parameters of the benchmark.
+	///
+	/// \return	false if the image differs from the reference or if the reference is missing.
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	bool runScene(BenchmarkScene const & description, Options const & options)
+	{
+		Geometry::Scene scene(options.m_width, options.m_height);
+		scene.setThreadCount(options.m_threads);
+		scene.setSeed(options.m_seed);
+		if(options.m_pathTracing)
+			scene.setIntegrator(Geometry::Scene::pathTracingIntegrator);
+		description.m_init(scene);
+		if(!description.m_emissive)
+			Scenes::initAreaLights(scene);
+		Scenes::initLights(scene);
+		Scenes::initCamera(scene);
+
+		// Scene::compute reports on the standard output, which is reserved to the benchmark report
+		::std::streambuf * output = ::std::cout.rdbuf(NULL);
+
+		// Untimed rendering: builds the hierarchies and counts the rays (the same for each iteration)
+		scene.setRayStatistics(true);
+		scene.compute(options.m_maxDepth, options.m_nbRandomRay);
+		scene.setRayStatistics(false);
+		System::RayStatistics::Counters const & counters = System::RayStatistics::instance().total();
+		long long rays = 0;
+		for(int type = 0; type < System::RayStatistics::rayTypeCount; type++)
+			rays += counters.m_rays[type];
+
+		::std::vector<double> times;
+		for(int iteration = 0; iteration < options.m_iterations; iteration++)
+		{
+			System::Timer timer;
+			scene.compute(options.m_maxDepth, options.m_nbRandomRay);
+			times.push_back(timer.elapsed());
+		}
+		::std::cout.rdbuf(output);
+		::std::sort(times.begin(), times.end());
+		const double median = percentile(times, 0.5);
+
+		::std::cout<<::std::left<<::std::setw(16)<<description.m_name<<::std::right
+			<<::std::setw(10)<<median
+			<<::std::setw(10)<<percentile(times, 0.95)
+			<<::std::setw(10)<<(median > 0.0 ? rays/median*1e-6 : 0.0);
+
+		// Comparison with the reference image
+		::std::string reference = options.m_references + (options.m_pathTracing ? "/pathtracing/" : "/") + description.m_name + ".ppm";
+		if(options.m_update)
+		{
+			bool written = scene.framebuffer().writePPM(reference.c_str());
+			::std::cout<<::std::setw(20)<<""<<(written ? "  updated" : "  cannot write "+reference)<<::std::endl;
+			return written;
+		}
+		::std::vector<unsigned char> image, expected;
+		int width, height;
+		if(!readPPM(reference, width, height, expected) || width != options.m_width || height != options.m_height)
+		{
+			::std::cout<<::std::setw(20)<<""<<"  no reference "<<options.m_width<<"x"<<options.m_height<<" "<<reference<<::std::endl;
+			return false;
+		}
+		scene.framebuffer().image(image);
+		const double error = rootMeanSquareError(image, expected);
+		const double psnr = error > 0.0 ? 20.0*log10(255.0/error) : HUGE_VAL;
+		const bool passed = psnr >= options.m_minPSNR;
+		::std::cout<<::std::setw(10)<<error<<::std::setw(10)<<psnr<<(passed ? "  ok" : "  FAILED")<<::std::endl;
+		return passed;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn	int main(int argc, char ** argv)
+///
+/// \brief	Main entry-point of the benchmark.
+///
+/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+/// \date	16/10/2026
+///
+/// \param	argc	Number of command-line arguments.
+/// \param	argv	Array of command-line argument strings.
+///
+/// \return	0 if every image matches its reference, 1 otherwise, 2 if the command line is invalid.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char ** argv)
+{
+	Options options;
+	if(!parseOptions(argc, argv, options))
+	{
+		::std::cerr<<"Usage: "<<argv[0]<<" [--scene name]... [--width n] [--height n] [--depth n] [--rays n] [--iterations n]"
+			<<" [--threads n] [--seed n] [--pathtracing] [--references directory] [--update] [--min-psnr dB]"<<::std::endl;
+		return 2;
+	}
+	::std::cout<<options.m_width<<"x"<<options.m_height<<", depth "<<options.m_maxDepth<<", "<<options.m_nbRandomRay
+		<<(options.m_pathTracing ? " paths per pixel" : " random rays")<<", "<<options.m_iterations<<" iterations, seed "<<options.m_seed
+#ifdef SSE_OPT
+		<<", SSE_OPT"
+#endif
+		<<::std::endl;
+	::std::cout<<::std::left<<::std::setw(16)<<"scene"<<::std::right<<::std::setw(10)<<"median(s)"<<::std::setw(10)<<"p95(s)"
+		<<::std::setw(10)<<"Mrays/s"<<::std::setw(10)<<"RMSE"<<::std::setw(10)<<"PSNR(dB)"<<::std::endl;
+	::std::cout<<::std::fixed<<::std::setprecision(3);
+
+	bool passed = true;
+	for(int i = 0; i < s_sceneCount; i++)
+	{
+		if(options.m_scenes.empty() || ::std::find(options.m_scenes.begin(), options.m_scenes.end(), s_scenes[i].m_name) != options.m_scenes.end())
+			passed = runScene(s_scenes[i], options) && passed;
+	}
+	return passed ? 0 : 1;
+}
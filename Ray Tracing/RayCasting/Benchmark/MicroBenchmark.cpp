@@ -0,0 +1,299 @@
+#include <Math/Vector3.h>
+#include <Math/Random.h>
+#include <Math/RandomDirection.h>
+#include <Geometry/Ray.h>
+#include <Geometry/Triangle.h>
+#include <Geometry/CastedRay.h>
+#include <Geometry/BoundingBox.h>
+#include <System/aligned_allocator.h>
+#include <System/Profiler.h>
+#include <stdlib.h>
+#include <math.h>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <limits>
+#include <algorithm>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief	Microbenchmark of the innermost kernels of the renderer: Triangle::intersection,
+/// 		BoundingBox::intersect and RandomDirection::generate. Each kernel is fed with pre-generated
+/// 		random primitives filling a working set of a given size (L1, L2 or DRAM), visited in a
+/// 		shuffled order so that the hardware prefetchers cannot hide the latency of the memory, and
+/// 		with a small stream of random rays. The result is the median time per call in nanoseconds.
+/// 		The kernels depend on SSE_OPT (Math/sse/Float4_functions.h, Math/Vector3.h): build the
+/// 		Release and Release_NoSSE configurations to compare both versions.
+///
+/// 		Usage: MicroBenchmark [--ops n] [--repeats n]
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+	/// \brief	Number of rays of the ray stream (a power of two small enough to stay in L1).
+	const int s_rayCount = 64;
+
+	/// \brief	A working set size.
+	struct WorkingSet
+	{
+		/// \brief	The name of the level of the memory hierarchy.
+		const char * m_name;
+		/// \brief	The size of the primitives in bytes.
+		size_t m_bytes;
+	};
+
+	/// \brief	The working set sizes: half of a typical L1 data cache, within a typical L2 cache and
+	/// 		well beyond the last level cache.
+	const WorkingSet s_workingSets[] =
+	{
+		{ "L1", 16*1024 },
+		{ "L2", 128*1024 },
+		{ "DRAM", 64*1024*1024 }
+	};
+
+	/// \brief	A random point in the box [-extent;extent]^3.
+	Math::Vector3 randomPoint(Math::Random & random, float extent)
+	{
+		return Math::Vector3(random.uniform()*2.0f - 1.0f, random.uniform()*2.0f - 1.0f, random.uniform()*2.0f - 1.0f)*extent;
+	}
+
+	/// \brief	A random unit vector.
+	Math::Vector3 randomDirection(Math::Random & random)
+	{
+		Math::Vector3 direction;
+		do
+		{
+			direction = randomPoint(random, 1.0f);
+		}
+		while(direction.norm() < 0.01f || direction.norm() > 1.0f);
+		return direction*(1.0f/direction.norm());
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \fn	std::vector<Geometry::Ray> createRays(Math::Random & random)
+	///
+	/// \brief	Creates the ray stream: rays starting at distance 3 from the origin and aiming at the
+	/// 		box [-1;1]^3 holding the primitives.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	///
+	/// \param [in,out]	random	The random number generator.
+	///
+	/// \return	The rays.
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	::std::vector<Geometry::Ray, aligned_allocator<Geometry::Ray, 16> > createRays(Math::Random & random)
+	{
+		::std::vector<Geometry::Ray, aligned_allocator<Geometry::Ray, 16> > rays;
+		for(int i = 0; i < s_rayCount; i++)
+		{
+			Math::Vector3 source = randomDirection(random)*3.0f;
+			Math::Vector3 direction = randomPoint(random, 1.0f) - source;
+			rays.push_back(Geometry::Ray(source, direction*(1.0f/direction.norm())));
+		}
+		return rays;
+	}
+
+	/// \brief	Calls Triangle::intersection.
+	class TriangleKernel
+	{
+	protected:
+		::std::vector<Math::Vector3, aligned_allocator<Math::Vector3, 16> > m_vertices;
+		::std::vector<Geometry::Triangle, aligned_allocator<Geometry::Triangle, 16> > m_triangles;
+
+	public:
+		static const char * name() { return "Triangle::intersection"; }
+
+		static size_t elementSize() { return sizeof(Geometry::Triangle); }
+
+		TriangleKernel(int count, Math::Random & random)
+			: m_vertices(3*count)
+		{
+			for(int i = 0; i < count; i++)
+			{
+				Math::Vector3 center = randomPoint(random, 1.0f);
+				for(int j = 0; j < 3; j++)
+					m_vertices[3*i + j] = center + randomPoint(random, 0.5f);
+				m_triangles.push_back(Geometry::Triangle(&m_vertices[3*i], &m_vertices[3*i + 1], &m_vertices[3*i + 2], NULL));
+			}
+		}
+
+		bool operator() (int element, Geometry::Ray const & ray, float & value) const
+		{
+			float u, v;
+			return m_triangles[element].intersection(ray, value, u, v);
+		}
+	};
+
+	/// \brief	Calls BoundingBox::intersect.
+	class BoxKernel
+	{
+	protected:
+		::std::vector<Geometry::BoundingBox, aligned_allocator<Geometry::BoundingBox, 16> > m_boxes;
+
+	public:
+		static const char * name() { return "BoundingBox::intersect"; }
+
+		static size_t elementSize() { return sizeof(Geometry::BoundingBox); }
+
+		BoxKernel(int count, Math::Random & random)
+		{
+			for(int i = 0; i < count; i++)
+			{
+				Math::Vector3 center = randomPoint(random, 1.0f);
+				Math::Vector3 extent(0.05f + 0.2f*random.uniform(), 0.05f + 0.2f*random.uniform(), 0.05f + 0.2f*random.uniform());
+				Geometry::BoundingBox box;
+				box.update(center - extent);
+				box.update(center + extent);
+				m_boxes.push_back(box);
+			}
+		}
+
+		bool operator() (int element, Geometry::Ray const & ray, float & value) const
+		{
+			return m_boxes[element].intersect(ray, 0.0f, ::std::numeric_limits<float>::max(), value);
+		}
+	};
+
+	/// \brief	Calls RandomDirection::generate (the rays are not used).
+	class DirectionKernel
+	{
+	protected:
+		::std::vector<Math::RandomDirection, aligned_allocator<Math::RandomDirection, 16> > m_directions;
+		mutable Math::Random m_random;
+
+	public:
+		static const char * name() { return "RandomDirection::generate"; }
+
+		static size_t elementSize() { return sizeof(Math::RandomDirection); }
+
+		DirectionKernel(int count, Math::Random & random)
+			: m_random(random.next())
+		{
+			// Diffuse (cosine) and specular (cos^n) distributions
+			for(int i = 0; i < count; i++)
+				m_directions.push_back(Math::RandomDirection(randomDirection(random), (i%2 == 0) ? 1.0f : 1.0f + 99.0f*random.uniform()));
+		}
+
+		bool operator() (int element, Geometry::Ray const &, float & value) const
+		{
+			Math::Vector3 direction = m_directions[element].generate(m_random);
+			value = direction[0] + direction[1] + direction[2];
+			return direction[2] > 0.0f;
+		}
+	};
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \fn	template <class Kernel> void run(WorkingSet const & workingSet, long long ops, int repeats)
+	///
+	/// \brief	Measures a kernel on a working set and prints its line of the report.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	///
+	/// \param	workingSet	The working set.
+	/// \param	ops		  	The minimum number of calls of a measure.
+	/// \param	repeats   	The number of measures.
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	template <class Kernel>
+	void run(WorkingSet const & workingSet, long long ops, int repeats)
+	{
+		Math::Random random(2026);
+		const int count = ::std::max(1, (int)(workingSet.m_bytes/Kernel::elementSize()));
+		const Kernel kernel(count, random);
+		const ::std::vector<Geometry::Ray, aligned_allocator<Geometry::Ray, 16> > rays = createRays(random);
+		// Shuffled order of the primitives (Fisher-Yates)
+		::std::vector<int> order(count);
+		for(int i = 0; i < count; i++)
+			order[i] = i;
+		for(int i = count - 1; i > 0; i--)
+			::std::swap(order[i], order[random.next()%(i + 1)]);
+
+		::std::vector<double> times;
+		long long hits = 0, calls = 0;
+		double sum = 0.0;
+		for(int repeat = 0; repeat < repeats; repeat++)
+		{
+			System::Timer timer;
+			long long done = 0;
+			while(done < ops)
+			{
+				for(int i = 0; i < count; i++)
+				{
+					float value;
+					if(kernel(order[i], rays[i & (s_rayCount - 1)], value))
+					{
+						hits++;
+						sum += value;
+					}
+				}
+				done += count;
+			}
+			times.push_back(timer.elapsed()*1e9/done);
+			calls += done;
+		}
+		::std::sort(times.begin(), times.end());
+
+		// The sum is printed so that the compiler cannot remove the calls
+		::std::cout<<::std::left<<::std::setw(28)<<Kernel::name()<<::std::setw(6)<<workingSet.m_name<<::std::right
+			<<::std::setw(12)<<workingSet.m_bytes/1024<<::std::setw(10)<<count
+			<<::std::setw(10)<<times[times.size()/2]
+			<<::std::setw(9)<<100.0*hits/calls<<"%"
+			<<"  (checksum "<<::std::setprecision(0)<<sum<<::std::setprecision(2)<<")"<<::std::endl;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn	int main(int argc, char ** argv)
+///
+/// \brief	Main entry-point of the microbenchmark.
+///
+/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+/// \date	16/10/2026
+///
+/// \param	argc	Number of command-line arguments.
+/// \param	argv	Array of command-line argument strings.
+///
+/// \return	0, or 2 if the command line is invalid.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char ** argv)
+{
+	long long ops = 1<<23;
+	int repeats = 5;
+	for(int i = 1; i < argc; i++)
+	{
+		::std::string option = argv[i];
+		if(option == "--ops" && i + 1 < argc)
+			ops = atoll(argv[++i]);
+		else if(option == "--repeats" && i + 1 < argc)
+			repeats = atoi(argv[++i]);
+		else
+			repeats = 0;
+	}
+	if(ops <= 0 || repeats <= 0)
+	{
+		::std::cerr<<"Usage: "<<argv[0]<<" [--ops n] [--repeats n]"<<::std::endl;
+		return 2;
+	}
+
+	::std::cout<<"Kernels built with "
+#if defined(AVX_OPT)
+		<<"SSE_OPT and AVX_OPT"
+#elif defined(SSE_OPT)
+		<<"SSE_OPT"
+#else
+		<<"scalar code (no SSE_OPT)"
+#endif
+		<<", median of "<<repeats<<" measures of at least "<<ops<<" calls"<<::std::endl;
+	::std::cout<<::std::left<<::std::setw(28)<<"kernel"<<::std::setw(6)<<"set"<<::std::right<<::std::setw(12)<<"size (KB)"
+		<<::std::setw(10)<<"elements"<<::std::setw(10)<<"ns/op"<<::std::setw(10)<<"hits"<<::std::endl;
+	::std::cout<<::std::fixed<<::std::setprecision(2);
+	const int workingSets = (int)(sizeof(s_workingSets)/sizeof(s_workingSets[0]));
+	for(int i = 0; i < workingSets; i++)
+		run<TriangleKernel>(s_workingSets[i], ops, repeats);
+	for(int i = 0; i < workingSets; i++)
+		run<BoxKernel>(s_workingSets[i], ops, repeats);
+	for(int i = 0; i < workingSets; i++)
+		run<DirectionKernel>(s_workingSets[i], ops, repeats);
+	return 0;
+}
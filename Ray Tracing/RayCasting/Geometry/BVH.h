@@ -0,0 +1,646 @@
+#ifndef _Geometry_BVH_H
+#define _Geometry_BVH_H
+
+#include <Geometry/BoundingBox.h>
+#include <Geometry/Ray.h>
+#include <System/aligned_allocator.h>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace Geometry
+{
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \class	BVH
+	///
+	/// \brief	A bounding volume hierarchy built with the surface area heuristic (binned SAH) or, when
+	/// 		the build time matters more than the traversal cost, as a linear BVH (primitives sorted
+	/// 		along a Morton curve, built in parallel). The hierarchy is built over a set of primitives
+	/// 		described by their bounding boxes and only stores primitive indices: the intersection
+	/// 		between a ray and a primitive is delegated to a functor provided during the traversal.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	class BVH
+	{
+	public:
+		/// \brief	Build algorithms: binned SAH (slower build, better hierarchy) or linear BVH.
+		enum BuildMode { highQualityBuild, fastBuild } ;
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \class	Node
+		///
+		/// \brief	A node of the hierarchy. Nodes are stored in depth first order: the left child of an
+		/// 		inner node immediately follows its parent.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		class Node
+		{
+		protected:
+			/// \brief	The box bounding all the primitives of the sub tree.
+			BoundingBox m_box ;
+			/// \brief	Index of the right child (inner node) or of the first primitive (leaf).
+			int m_index ;
+			/// \brief	Number of primitives (0 for an inner node).
+			int m_count ;
+
+		public:
+			Node(BoundingBox const & box = BoundingBox(), int index = 0, int count = 0)
+				: m_box(box), m_index(index), m_count(count)
+			{}
+
+			/// \brief	The box bounding the sub tree.
+			const BoundingBox & box() const
+			{ return m_box ; }
+
+			/// \brief	Is this node a leaf?
+			bool isLeaf() const
+			{ return m_count!=0 ; }
+
+			/// \brief	Index of the right child of an inner node (the left child is the next node).
+			int rightChild() const
+			{ return m_index ; }
+
+			/// \brief	Index of the first primitive of a leaf in BVH::primitives().
+			int firstPrimitive() const
+			{ return m_index ; }
+
+			/// \brief	Number of primitives of a leaf.
+			int primitiveCount() const
+			{ return m_count ; }
+		} ;
+
+		/// \brief	Cost of the traversal of a node relative to the cost of a primitive intersection.
+		static float traversalCost()
+		{ return 1.0f ; }
+
+	protected:
+		/// \brief	Number of bins used to evaluate the surface area heuristic on each axis.
+		static const int s_binCount = 16 ;
+		/// \brief	Default maximum number of primitives in a leaf.
+		static const int s_maxLeafSize = 4 ;
+		/// \brief	Depth from which nodes are split at the median (bounds the traversal stack size).
+		static const int s_maxSahDepth = 32 ;
+		/// \brief	Number of bits per axis of the Morton codes (linear build).
+		static const int s_mortonBits = 10 ;
+		/// \brief	Number of bits sorted by each pass of the radix sort (linear build).
+		static const int s_radixBits = 10 ;
+		/// \brief	The nodes (the root is the first one).
+		::std::vector<Node, aligned_allocator<Node, 16> > m_nodes ;
+		/// \brief	Primitive indices referenced by the leaves.
+		::std::vector<int> m_primitives ;
+		/// \brief	Maximum number of primitives in a leaf.
+		int m_maxLeafSize ;
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	int BVH::buildNode(BoxVector const & boxes, PointVector const & centroids, int begin,
+		/// 	int end, int depth)
+		///
+		/// \brief	Recursively builds the sub tree bounding primitives m_primitives[begin..end[.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	boxes	 	The bounding boxes of the primitives.
+		/// \param	centroids	The centers of the primitive bounding boxes.
+		/// \param	begin	 	The first primitive.
+		/// \param	end		 	The end of the primitive range.
+		/// \param	depth	 	The depth of the node.
+		///
+		/// \return	The index of the created node.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		template <class BoxVector, class PointVector>
+		int buildNode(BoxVector const & boxes, PointVector const & centroids, int begin, int end, int depth)
+		{
+			int nodeIndex = (int)m_nodes.size() ;
+			m_nodes.push_back(Node()) ;
+
+			BoundingBox box, centroidBox ;
+			for(int cpt=begin ; cpt<end ; ++cpt)
+			{
+				box.update(boxes[m_primitives[cpt]]) ;
+				centroidBox.update(centroids[m_primitives[cpt]]) ;
+			}
+			int count = end-begin ;
+			if(count==1)
+			{
+				m_nodes[nodeIndex] = Node(box, begin, count) ;
+				return nodeIndex ;
+			}
+
+			// Evaluation of the surface area heuristic on each axis
+			int bestAxis = -1 ;
+			int bestBin = 0 ;
+			float bestCost = ::std::numeric_limits<float>::max() ;
+			if(depth<s_maxSahDepth)
+			{
+				for(int axis=0 ; axis<3 ; ++axis)
+				{
+					float minCentroid = centroidBox.minVertex()[axis] ;
+					float extent = centroidBox.maxVertex()[axis]-minCentroid ;
+					if(extent<=0.0f) { continue ; }
+					float scale = s_binCount/extent ;
+
+					BoundingBox binBoxes[s_binCount] ;
+					int binCounts[s_binCount] = { 0 } ;
+					for(int cpt=begin ; cpt<end ; ++cpt)
+					{
+						int primitive = m_primitives[cpt] ;
+						int bin = ::std::min(s_binCount-1, (int)((centroids[primitive][axis]-minCentroid)*scale)) ;
+						binBoxes[bin].update(boxes[primitive]) ;
+						binCounts[bin]++ ;
+					}
+
+					// Right to left sweep: cost of the primitives on the right of each split
+					float rightCost[s_binCount] ;
+					BoundingBox rightBox ;
+					int rightCount = 0 ;
+					for(int bin=s_binCount-1 ; bin>0 ; --bin)
+					{
+						rightBox.update(binBoxes[bin]) ;
+						rightCount += binCounts[bin] ;
+						rightCost[bin] = rightBox.surface()*rightCount ;
+					}
+					// Left to right sweep: full cost of each split
+					BoundingBox leftBox ;
+					int leftCount = 0 ;
+					for(int bin=1 ; bin<s_binCount ; ++bin)
+					{
+						leftBox.update(binBoxes[bin-1]) ;
+						leftCount += binCounts[bin-1] ;
+						float cost = leftBox.surface()*leftCount + rightCost[bin] ;
+						if(leftCount!=0 && leftCount!=count && cost<bestCost)
+						{
+							bestCost = cost ;
+							bestAxis = axis ;
+							bestBin = bin ;
+						}
+					}
+				}
+			}
+
+			float leafCost = box.surface()*count ;
+			float splitCost = box.surface()*traversalCost() + bestCost ;
+			if(count<=m_maxLeafSize && (bestAxis==-1 || leafCost<=splitCost))
+			{
+				m_nodes[nodeIndex] = Node(box, begin, count) ;
+				return nodeIndex ;
+			}
+
+			int middle ;
+			if(bestAxis!=-1)
+			{
+				// Partition of the primitives according to the best split
+				float minCentroid = centroidBox.minVertex()[bestAxis] ;
+				float scale = s_binCount/(centroidBox.maxVertex()[bestAxis]-minCentroid) ;
+				int * first = &m_primitives[0]+begin ;
+				int * last = &m_primitives[0]+end ;
+				int * split = first ;
+				for(int * it=first ; it!=last ; ++it)
+				{
+					int bin = ::std::min(s_binCount-1, (int)((centroids[*it][bestAxis]-minCentroid)*scale)) ;
+					if(bin<bestBin) { ::std::swap(*it, *split) ; ++split ; }
+				}
+				middle = begin+(int)(split-first) ;
+			}
+			else
+			{
+				// Median split on the largest axis (too deep or all centroids are identical)
+				Math::Vector3 extent = centroidBox.maxVertex()-centroidBox.minVertex() ;
+				int axis = (extent[0]>extent[1]) ? ((extent[0]>extent[2]) ? 0 : 2) : ((extent[1]>extent[2]) ? 1 : 2) ;
+				middle = (begin+end)/2 ;
+				::std::nth_element(m_primitives.begin()+begin, m_primitives.begin()+middle, m_primitives.begin()+end, CentroidLess<PointVector>(centroids, axis)) ;
+			}
+
+			buildNode(boxes, centroids, begin, middle, depth+1) ;
+			int right = buildNode(boxes, centroids, middle, end, depth+1) ;
+			m_nodes[nodeIndex] = Node(box, right, 0) ;
+			return nodeIndex ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	static unsigned int BVH::expandBits(unsigned int value)
+		///
+		/// \brief	Inserts two zero bits after each of the 10 low bits of value.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		static unsigned int expandBits(unsigned int value)
+		{
+			value = (value * 0x00010001u) & 0xFF0000FFu ;
+			value = (value * 0x00000101u) & 0x0F00F00Fu ;
+			value = (value * 0x00000011u) & 0xC30C30C3u ;
+			value = (value * 0x00000005u) & 0x49249249u ;
+			return value ;
+		}
+
+		/// \brief	Number of leading zero bits of a non null value.
+		static int countLeadingZeros(unsigned int value)
+		{
+#ifdef _MSC_VER
+			unsigned long index ;
+			_BitScanReverse(&index, value) ;
+			return 31-(int)index ;
+#else
+			return __builtin_clz(value) ;
+#endif
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	static void BVH::radixSort(::std::vector< ::std::pair<unsigned int, int> > & items)
+		///
+		/// \brief	Sorts (Morton code, primitive) pairs by code. Each pass of the least significant digit
+		/// 		radix sort is parallel: every thread counts the digits of its block, then scatters it at
+		/// 		the offsets deduced from all the counts, which keeps the sort stable.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param [in,out]	items	The pairs to sort.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		static void radixSort(::std::vector< ::std::pair<unsigned int, int> > & items)
+		{
+			const int radixSize = 1<<s_radixBits ;
+			const int size = (int)items.size() ;
+			::std::vector< ::std::pair<unsigned int, int> > buffer(items.size()) ;
+			::std::vector<int> offsets ;
+			for(int shift=0 ; shift<3*s_mortonBits ; shift+=s_radixBits)
+			{
+#pragma omp parallel
+				{
+					int thread = 0 ;
+					int threadCount = 1 ;
+#ifdef _OPENMP
+					thread = omp_get_thread_num() ;
+					threadCount = omp_get_num_threads() ;
+#endif
+#pragma omp single
+					offsets.assign(threadCount*radixSize, 0) ;
+
+					int begin = (int)((long long)size*thread/threadCount) ;
+					int end = (int)((long long)size*(thread+1)/threadCount) ;
+					int * histogram = &offsets[thread*radixSize] ;
+					for(int cpt=begin ; cpt<end ; ++cpt)
+					{
+						histogram[(items[cpt].first>>shift)&(radixSize-1)]++ ;
+					}
+#pragma omp barrier
+#pragma omp single
+					{
+						int sum = 0 ;
+						for(int digit=0 ; digit<radixSize ; ++digit)
+						{
+							for(int other=0 ; other<threadCount ; ++other)
+							{
+								int count = offsets[other*radixSize+digit] ;
+								offsets[other*radixSize+digit] = sum ;
+								sum += count ;
+							}
+						}
+					}
+					for(int cpt=begin ; cpt<end ; ++cpt)
+					{
+						buffer[histogram[(items[cpt].first>>shift)&(radixSize-1)]++] = items[cpt] ;
+					}
+				}
+				items.swap(buffer) ;
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	static int BVH::commonPrefix(::std::vector<unsigned int> const & codes, int i, int j)
+		///
+		/// \brief	Length of the common prefix of the sorted Morton codes i and j. Equal codes are
+		/// 		distinguished by their position so that all the keys are unique.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \return	The length of the common prefix, -1 if j is out of range.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		static int commonPrefix(::std::vector<unsigned int> const & codes, int i, int j)
+		{
+			if(j<0 || j>=(int)codes.size()) { return -1 ; }
+			if(codes[i]==codes[j]) { return 32+countLeadingZeros((unsigned int)(i^j)) ; }
+			return countLeadingZeros(codes[i]^codes[j]) ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	static int BVH::findSplit(::std::vector<unsigned int> const & codes, int i)
+		///
+		/// \brief	Computes the split of the internal node i of the radix tree defined by the sorted Morton
+		/// 		codes (T. Karras, Maximizing parallelism in the construction of BVHs, octrees, and k-d
+		/// 		trees, HPG 2012). Each internal node is computed independently of the others.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	codes	The sorted Morton codes.
+		/// \param	i	 	The internal node.
+		///
+		/// \return	The split: the node covers a range [first;last] and its children cover [first;split]
+		/// 		and [split+1;last]. The left (resp. right) child is the internal node split (resp.
+		/// 		split+1) if its range contains more than one primitive.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		static int findSplit(::std::vector<unsigned int> const & codes, int i)
+		{
+			// Direction of the range covered by the node
+			int direction = (commonPrefix(codes, i, i+1)-commonPrefix(codes, i, i-1))>0 ? 1 : -1 ;
+			int minPrefix = commonPrefix(codes, i, i-direction) ;
+			// Other end of the range
+			int maxLength = 2 ;
+			while(commonPrefix(codes, i, i+maxLength*direction)>minPrefix) { maxLength *= 2 ; }
+			int length = 0 ;
+			for(int step=maxLength/2 ; step>=1 ; step/=2)
+			{
+				if(commonPrefix(codes, i, i+(length+step)*direction)>minPrefix) { length += step ; }
+			}
+			int other = i+length*direction ;
+			// Position of the highest differing bit in the range
+			int nodePrefix = commonPrefix(codes, i, other) ;
+			int split = 0 ;
+			int step = length ;
+			do
+			{
+				step = (step+1)/2 ;
+				if(commonPrefix(codes, i, i+(split+step)*direction)>nodePrefix) { split += step ; }
+			}
+			while(step>1) ;
+			return i+split*direction+::std::min(direction, 0) ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	int BVH::buildLinearNode(BoxVector const & boxes, ::std::vector<int> const & splits,
+		/// 	int internal, int first, int last)
+		///
+		/// \brief	Emits the nodes of the radix tree in depth first order, computing their boxes. Ranges
+		/// 		of at most m_maxLeafSize primitives become leaves.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	boxes   	The bounding boxes of the primitives.
+		/// \param	splits  	The splits of the internal nodes of the radix tree.
+		/// \param	internal	The internal node covering [first;last] (unused for a leaf).
+		/// \param	first   	The first primitive (position in m_primitives).
+		/// \param	last		The last primitive.
+		///
+		/// \return	The index of the created node.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		template <class BoxVector>
+		int buildLinearNode(BoxVector const & boxes, ::std::vector<int> const & splits, int internal, int first, int last)
+		{
+			int nodeIndex = (int)m_nodes.size() ;
+			m_nodes.push_back(Node()) ;
+			int count = last-first+1 ;
+			if(count<=m_maxLeafSize)
+			{
+				BoundingBox box ;
+				for(int cpt=first ; cpt<=last ; ++cpt)
+				{
+					box.update(boxes[m_primitives[cpt]]) ;
+				}
+				m_nodes[nodeIndex] = Node(box, first, count) ;
+				return nodeIndex ;
+			}
+			int split = splits[internal] ;
+			int left = buildLinearNode(boxes, splits, split, first, split) ;
+			int right = buildLinearNode(boxes, splits, split+1, split+1, last) ;
+			BoundingBox box(m_nodes[left].box()) ;
+			box.update(m_nodes[right].box()) ;
+			m_nodes[nodeIndex] = Node(box, right, 0) ;
+			return nodeIndex ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void BVH::buildLinear(BoxVector const & boxes)
+		///
+		/// \brief	Builds a linear BVH: Morton codes of the primitive centroids (quantized in the box of
+		/// 		the centroids) are computed and radix sorted in parallel, then the radix tree over the
+		/// 		sorted codes is built in parallel, one internal node per primitive.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	boxes	The bounding boxes of the primitives.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		template <class BoxVector>
+		void buildLinear(BoxVector const & boxes)
+		{
+			const int size = (int)boxes.size() ;
+			BoundingBox centroidBox ;
+			for(int cpt=0 ; cpt<size ; ++cpt)
+			{
+				centroidBox.update(boxes[cpt].center()) ;
+			}
+			Math::Vector3 origin = centroidBox.minVertex() ;
+			Math::Vector3 extent = centroidBox.maxVertex()-centroidBox.minVertex() ;
+			float scale[3] ;
+			for(int axis=0 ; axis<3 ; ++axis)
+			{
+				scale[axis] = (extent[axis]>0.0f) ? (1<<s_mortonBits)/extent[axis] : 0.0f ;
+			}
+
+			// Morton codes
+			::std::vector< ::std::pair<unsigned int, int> > items(size) ;
+#pragma omp parallel for
+			for(int cpt=0 ; cpt<size ; ++cpt)
+			{
+				Math::Vector3 centroid = boxes[cpt].center()-origin ;
+				unsigned int code = 0 ;
+				for(int axis=0 ; axis<3 ; ++axis)
+				{
+					int cell = ::std::min((1<<s_mortonBits)-1, ::std::max(0, (int)(centroid[axis]*scale[axis]))) ;
+					code |= expandBits((unsigned int)cell)<<(2-axis) ;
+				}
+				items[cpt] = ::std::make_pair(code, cpt) ;
+			}
+			radixSort(items) ;
+
+			::std::vector<unsigned int> codes(size) ;
+			for(int cpt=0 ; cpt<size ; ++cpt)
+			{
+				codes[cpt] = items[cpt].first ;
+				m_primitives[cpt] = items[cpt].second ;
+			}
+
+			// Radix tree
+			::std::vector<int> splits(::std::max(size-1, 0)) ;
+#pragma omp parallel for
+			for(int cpt=0 ; cpt<size-1 ; ++cpt)
+			{
+				splits[cpt] = findSplit(codes, cpt) ;
+			}
+			buildLinearNode(boxes, splits, 0, 0, size-1) ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \class	CentroidLess
+		///
+		/// \brief	Compares primitives along an axis using their centroids.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		template <class PointVector>
+		class CentroidLess
+		{
+		protected:
+			const PointVector * m_centroids ;
+			int m_axis ;
+		public:
+			CentroidLess(PointVector const & centroids, int axis)
+				: m_centroids(&centroids), m_axis(axis)
+			{}
+
+			bool operator() (int p0, int p1) const
+			{ return (*m_centroids)[p0][m_axis] < (*m_centroids)[p1][m_axis] ; }
+		} ;
+
+	public:
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	BVH::BVH()
+		///
+		/// \brief	Default constructor (empty hierarchy).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		BVH()
+			: m_maxLeafSize(s_maxLeafSize)
+		{}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void BVH::build(::std::vector<BoundingBox, aligned_allocator<BoundingBox, 16> > const & boxes,
+		/// 	int maxLeafSize, BuildMode mode)
+		///
+		/// \brief	Builds the hierarchy over the primitives described by the provided bounding boxes.
+		/// 		The primitive with index i in the traversal functor is boxes[i].
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	boxes	   	The bounding boxes of the primitives.
+		/// \param	maxLeafSize	The maximum number of primitives in a leaf.
+		/// \param	mode	   	The build algorithm.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void build(::std::vector<BoundingBox, aligned_allocator<BoundingBox, 16> > const & boxes, int maxLeafSize = s_maxLeafSize, BuildMode mode = highQualityBuild)
+		{
+			m_maxLeafSize = maxLeafSize ;
+			m_nodes.clear() ;
+			m_primitives.resize(boxes.size()) ;
+			if(boxes.empty()) { return ; }
+
+			m_nodes.reserve(2*boxes.size()) ;
+			if(mode==fastBuild)
+			{
+				buildLinear(boxes) ;
+				return ;
+			}
+
+			::std::vector<Math::Vector3, aligned_allocator<Math::Vector3, 16> > centroids ;
+			centroids.reserve(boxes.size()) ;
+			for(int cpt=0 ; cpt<(int)boxes.size() ; ++cpt)
+			{
+				m_primitives[cpt] = cpt ;
+				centroids.push_back(boxes[cpt].center()) ;
+			}
+			buildNode(boxes, centroids, 0, (int)boxes.size(), 0) ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	const ::std::vector<Node, aligned_allocator<Node, 16> > & BVH::nodes() const
+		///
+		/// \brief	Gets the nodes of the hierarchy.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \return	The nodes, the root being the first one.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		const ::std::vector<Node, aligned_allocator<Node, 16> > & nodes() const
+		{ return m_nodes ; }
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	const ::std::vector<int> & BVH::primitives() const
+		///
+		/// \brief	Gets the primitive indices referenced by the leaves.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \return	The primitive indices.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		const ::std::vector<int> & primitives() const
+		{ return m_primitives ; }
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	float BVH::sahCost() const
+		///
+		/// \brief	Computes the cost of the hierarchy according to the surface area heuristic: the
+		/// 		expected number of node traversals (weighted by traversalCost()) and of primitive
+		/// 		intersections for a ray crossing the root box. Useful to compare the build modes.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \return	The cost (0 for an empty hierarchy).
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		float sahCost() const
+		{
+			if(m_nodes.empty()) { return 0.0f ; }
+			float rootSurface = m_nodes[0].box().surface() ;
+			if(rootSurface<=0.0f) { return (float)m_primitives.size() ; }
+			float cost = 0.0f ;
+			for(int cpt=0 ; cpt<(int)m_nodes.size() ; ++cpt)
+			{
+				const Node & node = m_nodes[cpt] ;
+				float probability = node.box().surface()/rootSurface ;
+				cost += probability * (node.isLeaf() ? (float)node.primitiveCount() : traversalCost()) ;
+			}
+			return cost ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void BVH::groupLeaves(::std::vector< ::std::pair<int, int> > & leaves)
+		///
+		/// \brief	Turns each leaf into a single primitive: after this call, leaf i references primitive
+		/// 		i only. This is used by owners that store the primitives of a leaf together (see
+		/// 		TriangleBVH).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param [out]	leaves	For each leaf, the range (first, count) it referenced in primitives().
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void groupLeaves(::std::vector< ::std::pair<int, int> > & leaves)
+		{
+			leaves.clear() ;
+			for(int cpt=0 ; cpt<(int)m_nodes.size() ; ++cpt)
+			{
+				if(m_nodes[cpt].isLeaf())
+				{
+					leaves.push_back(::std::make_pair(m_nodes[cpt].firstPrimitive(), m_nodes[cpt].primitiveCount())) ;
+					m_nodes[cpt] = Node(m_nodes[cpt].box(), (int)leaves.size()-1, 1) ;
+				}
+			}
+			m_primitives.resize(leaves.size()) ;
+			for(int cpt=0 ; cpt<(int)m_primitives.size() ; ++cpt)
+			{
+				m_primitives[cpt] = cpt ;
+			}
+		}
+	} ;
+}
+
+#endif
@@ -2,6 +2,7 @@
 #define _Geometry_BoundingBox_H
 
 #include <Geometry/Geometry.h>
+#include <limits>
 
 namespace Geometry
 {
@@ -10,7 +11,7 @@ namespace Geometry
 	///
 	/// \brief	A bounding box.
 	///
-	/// \author	F. Lamarche, Universit de Rennes 1
+	/// \author	F. Lamarche, Université de Rennes 1
 	/// \date	04/12/2013
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	class BoundingBox
@@ -20,12 +21,45 @@ namespace Geometry
 		Math::Vector3 m_bounds[2] ;
 	public:
 
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	BoundingBox::BoundingBox()
+		///
+		/// \brief	Default constructor. Builds an empty bounding box (any call to update makes it bound 
+		/// 		the provided data).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		BoundingBox()
+		{
+			m_bounds[0] = Math::Vector3(::std::numeric_limits<float>::max(), ::std::numeric_limits<float>::max(), ::std::numeric_limits<float>::max()) ;
+			m_bounds[1] = Math::Vector3(-::std::numeric_limits<float>::max(), -::std::numeric_limits<float>::max(), -::std::numeric_limits<float>::max()) ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	BoundingBox::BoundingBox(Triangle const & triangle)
+		///
+		/// \brief	Initializes the bounding box from the provided triangle.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	triangle	The triangle.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		BoundingBox(Triangle const & triangle)
+		{
+			m_bounds[0] = triangle.vertex(0) ;
+			m_bounds[1] = triangle.vertex(0) ;
+			update(triangle.vertex(1)) ;
+			update(triangle.vertex(2)) ;
+		}
+
 		////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// \fn	BoundingBox::BoundingBox(Geometry const & geometry)
 		///
 		/// \brief	Initializes the bounding box from the provided geometry.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	geometry	The geometry.
@@ -40,7 +74,7 @@ namespace Geometry
 		///
 		/// \brief	Constructor.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	minVertex	The smallest coordinates on X, Y, Z axes.
@@ -57,7 +91,7 @@ namespace Geometry
 		///
 		/// \brief	Sets the bouding box with the given geometry.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	10/12/2013
 		///
 		/// \param	geometry	The geometry.
@@ -75,7 +109,7 @@ namespace Geometry
 		///
 		/// \brief	Updates the bounding box with the given geometry.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	10/12/2013
 		///
 		/// \param	geometry	The geometry.
@@ -95,7 +129,7 @@ namespace Geometry
 		///
 		/// \brief	Updates this bounding box to bound the given boundingBox.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	10/12/2013
 		///
 		/// \param	boundingBox	The bounding box.
@@ -106,12 +140,88 @@ namespace Geometry
 			m_bounds[1] = m_bounds[1].simdMax(boundingBox.m_bounds[1]) ;
 		}
 
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void BoundingBox::update(Math::Vector3 const & point)
+		///
+		/// \brief	Updates this bounding box to bound the given point.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	point	The point.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void update(Math::Vector3 const & point)
+		{
+			m_bounds[0] = m_bounds[0].simdMin(point) ;
+			m_bounds[1] = m_bounds[1].simdMax(point) ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	const Math::Vector3 & BoundingBox::minVertex() const
+		///
+		/// \brief	Gets the smallest coordinates on X, Y, Z axes.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \return	.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		const Math::Vector3 & minVertex() const
+		{ return m_bounds[0] ; }
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	const Math::Vector3 & BoundingBox::maxVertex() const
+		///
+		/// \brief	Gets the highest coordinates on X, Y, Z axes.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \return	.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		const Math::Vector3 & maxVertex() const
+		{ return m_bounds[1] ; }
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	Math::Vector3 BoundingBox::center() const
+		///
+		/// \brief	Gets the center of the box.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \return	.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		Math::Vector3 center() const
+		{ return (m_bounds[0]+m_bounds[1])*0.5f ; }
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	float BoundingBox::surface() const
+		///
+		/// \brief	Gets the surface area of the box (used by the surface area heuristic). An empty box 
+		/// 		has a null surface.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \return	The surface area.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		float surface() const
+		{
+			Math::Vector3 extent = m_bounds[1]-m_bounds[0] ;
+			if(extent[0]<0.0f || extent[1]<0.0f || extent[2]<0.0f)
+			{
+				return 0.0f ;
+			}
+			return 2.0f*(extent[0]*extent[1] + extent[1]*extent[2] + extent[2]*extent[0]) ;
+		}
+
 		////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// \fn	bool BoundingBox::intersect(const Ray & ray) const
 		///
 		/// \brief	Tests if the provided ray intersects this box.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	09/12/2013
 		///
 		/// \param	ray	The ray.
@@ -119,6 +229,28 @@ namespace Geometry
 		/// \return	true if an intersection is found, false otherwise.
 		////////////////////////////////////////////////////////////////////////////////////////////////////
 		bool intersect(const Ray & ray, float t0, float t1) const
+		{
+			float tEntry ;
+			return intersect(ray, t0, t1, tEntry) ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	bool BoundingBox::intersect(const Ray & ray, float t0, float t1, float & tEntry) const
+		///
+		/// \brief	Tests if the provided ray intersects this box in the interval [t0;t1] and computes the
+		/// 		distance at which the ray enters the box (useful to order the traversal of a hierarchy).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	ray			  	The ray.
+		/// \param	t0			  	The lower bound of the tested interval.
+		/// \param	t1			  	The upper bound of the tested interval.
+		/// \param [out]	tEntry	The entry distance of the ray in the box (clamped to t0).
+		///
+		/// \return	true if an intersection is found, false otherwise.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		bool intersect(const Ray & ray, float t0, float t1, float & tEntry) const
 		{
 			//int sign[3] = { ray.direction()[0]<0.0, ray.direction()[1]<0.0, ray.direction()[2]<0.0 } ;
 			const int * sign = ray.getSign() ;
@@ -152,6 +284,7 @@ namespace Geometry
 			{
 				tmax[0] = tmax[2] ; 
 			}
+			tEntry = (tmin[0]>t0) ? tmin[0] : t0 ;
 			return (tmin[0]<t1) && (tmax[0]>t0) ;
 		}
 	} ;
@@ -13,7 +13,7 @@ namespace Geometry
 	///
 	/// \brief	A camera.
 	///
-	/// \author	F. Lamarche, Universit de Rennes 1
+	/// \author	F. Lamarche, Université de Rennes 1
 	/// \date	04/12/2013
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	class Camera
@@ -47,7 +47,7 @@ namespace Geometry
 		///
 		/// \brief	Calculates the camera parameters.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		////////////////////////////////////////////////////////////////////////////////////////////////////
 		void computeParameters()
@@ -70,9 +70,9 @@ namespace Geometry
 		/// 	Math::Vector3 const & target = Math::Vector3(0.0, 1.0, 0.0), float planeDistance=1.0,
 		/// 	float planeWidth=1.0, float planeHeight=1.0)
 		///
-		/// \brief	Constructeur de la camra.
+		/// \brief	Constructeur de la caméra.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	position	 	The camera position
@@ -95,7 +95,7 @@ namespace Geometry
 		///
 		/// \brief	Sets the camera position position.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	position	The new camera position.
@@ -111,7 +111,7 @@ namespace Geometry
 		///
 		/// \brief	Sets the target.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	target	The new target.
@@ -127,7 +127,7 @@ namespace Geometry
 		///
 		/// \brief	Get a primary ray from screen coordinates (coordX, coordY)
 		/// 		
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	coordX	X coordinate in the projection rectangle.
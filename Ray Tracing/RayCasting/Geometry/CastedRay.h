@@ -13,7 +13,7 @@ namespace Geometry
 	///
 	/// \brief	A ray that keeps track of the nearest intersection found so far.
 	///
-	/// \author	F. Lamarche, Universit de Rennes 1
+	/// \author	F. Lamarche, Université de Rennes 1
 	/// \date	04/12/2013
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	class CastedRay : public Ray
@@ -30,7 +30,7 @@ namespace Geometry
 		///
 		/// \brief	Constructor.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	source   	The ray source.
@@ -50,7 +50,7 @@ namespace Geometry
 		/// \brief	Computes the intersection between the current ray and the provided triangle. If the coputed 
 		/// 		intersection is the nearest to the source, it is recorded.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param [in,out]	triangle	The triangle.
@@ -75,7 +75,7 @@ namespace Geometry
 		/// \warning A call to this method should be peceeded by a call to validIntersectionFound to ensure
 		/// 		 that the returned intersection is valid.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \return	.
@@ -88,7 +88,7 @@ namespace Geometry
 		///
 		/// \brief	To know if a valid intersection as been found so far.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \return	true if it succeeds, false if it fails.
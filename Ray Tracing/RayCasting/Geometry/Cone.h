@@ -5,14 +5,14 @@
 
 namespace Geometry
 {
-	/** \brief Reprsentation d'un cone */
+	/** \brief Représentation d'un cone */
 
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// \class	Cone
 	///
 	/// \brief	A cone, centered in (0,0,0), 1.0 height, 1.0 base radius.
 	///
-	/// \author	F. Lamarche, Universit de Rennes 1
+	/// \author	F. Lamarche, Université de Rennes 1
 	/// \date	04/12/2013
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	class Cone : public Geometry
@@ -24,7 +24,7 @@ namespace Geometry
 		///
 		/// \brief	Constructor.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	nbDiv   	Number of base circle subdivisions.
@@ -8,7 +8,7 @@ namespace Geometry
 	///
 	/// \brief	A Cornell box with different materials on its 6 faces.
 	/// 		
-	/// \author	F. Lamarche, Universit de Rennes 1
+	/// \author	F. Lamarche, Université de Rennes 1
 	/// \date	04/12/2013
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	class Cornel : public Geometry
@@ -25,7 +25,7 @@ namespace Geometry
 		///
 		/// \brief	Constructeur d'une Cornel box.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param [in,out]	up   	The up material.
@@ -67,7 +67,7 @@ namespace Geometry
 			sq5.rotate(Math::Quaternion(Math::Vector3(0.0f,1.0f,0.0f), (float)-M_PI/2.0f)) ;
 			merge(sq5) ;
 
-			//// Dclaration des carrs constituant les faces
+			//// Déclaration des carrés constituant les faces
 			//m_square[0] = new Square(up) ;
 			//m_square[0]->translate(Math::Vector3(0.0,0.0,0.5)) ;
 			//m_square[1] = new Square(left) ;
@@ -85,7 +85,7 @@ namespace Geometry
 			//m_square[5] = new Square(back) ;
 			//m_square[5]->translate(Math::Vector3(0.0,0.0,0.5)) ;
 			//m_square[5]->rotate(Math::Quaternion(Math::Vector3(0.0,1.0,0.0), (float)-M_PI/2.0f)) ;
-			//// Ajout des gomtries dans cette gomtrie
+			//// Ajout des géométries dans cette géométrie
 			//merge(m_square[0]) ;
 			//merge(m_square[1]) ;
 			//merge(m_square[2]) ;
@@ -15,7 +15,7 @@ namespace Geometry
 	///
 	/// \brief	A cube centered in (0,0,0), 1.0 height/width....
 	///
-	/// \author	F. Lamarche, Universit de Rennes 1
+	/// \author	F. Lamarche, Université de Rennes 1
 	/// \date	04/12/2013
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	class Cube : public Geometry
@@ -30,7 +30,7 @@ namespace Geometry
 		///
 		/// \brief	Constructeur
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param [in,out]	material	The material.
@@ -67,7 +67,7 @@ namespace Geometry
 			sq5.rotate(Math::Quaternion(Math::Vector3(0.0f,1.0f,0.0f), (float)-M_PI/2.0f)) ;
 			merge(sq5) ;
 
-			// Dclaration des carrs constituant les faces
+			// Déclaration des carrés constituant les faces
 			//m_square[0] = new Square(material) ;
 			//m_square[0]->translate(Math::Vector3(0.0f,0.0f,0.5f)) ;
 			//m_square[1] = new Square(material) ;
@@ -85,7 +85,7 @@ namespace Geometry
 			//m_square[5] = new Square(material) ;
 			//m_square[5]->translate(Math::Vector3(0.0f,0.0f,0.5f)) ;
 			//m_square[5]->rotate(Math::Quaternion(Math::Vector3(0.0f,1.0f,0.0f), (float)-M_PI/2.0f)) ;
-			// Ajout des gomtries dans cette gomtrie
+			// Ajout des géométries dans cette géométrie
 			//merge(m_square[0]) ;
 			//merge(m_square[1]) ;
 			//merge(m_square[2]) ;
@@ -6,14 +6,14 @@
 
 namespace Geometry
 {
-	/** \brief Classe dcrivant la gomtrie d'un cylindre */
+	/** \brief Classe décrivant la géométrie d'un cylindre */
 
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// \class	Cylinder
 	///
 	/// \brief	A cylinder centered in (0,0,0), 1.0 height, 1.0 diameter.
 	///
-	/// \author	F. Lamarche, Universit de Rennes 1
+	/// \author	F. Lamarche, Université de Rennes 1
 	/// \date	04/12/2013
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	class Cylinder : public Geometry
@@ -25,7 +25,7 @@ namespace Geometry
 		///
 		/// \brief	Constructor
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	nbDiv	 	Number of base circle subdivisions.
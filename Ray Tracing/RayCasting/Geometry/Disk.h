@@ -10,14 +10,14 @@
 
 namespace Geometry
 {
-	/** \brief Classe dcrivant la gomtrie d'un disque */
+	/** \brief Classe décrivant la géométrie d'un disque */
 
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// \class	Disk
 	///
 	/// \brief	A disk on (X,Y) plane, centered in (0,0,0) with a 0.5 radius.
 	///
-	/// \author	F. Lamarche, Universit de Rennes 1
+	/// \author	F. Lamarche, Université de Rennes 1
 	/// \date	04/12/2013
 	///////////////////////////////////////////////////////////////////////////////////////////////////
 	class Disk : public Geometry
@@ -30,7 +30,7 @@ namespace Geometry
 		///
 		/// \brief	Construtor
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	nbDiv   	Number of subdivisions of the circle delimiting the disk.
@@ -0,0 +1,317 @@
+#ifndef _Geometry_Framebuffer_H
+#define _Geometry_Framebuffer_H
+
+#include <Geometry/RGBColor.h>
+#include <System/aligned_allocator.h>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <cstdio>
+#include <math.h>
+
+namespace Geometry
+{
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \class	Framebuffer
+	///
+	/// \brief	Accumulation buffer of a rendering: the sum of the samples of each pixel, their number
+	/// 		and the spread of their luminance. The image is stored tile by tile (tiles of
+	/// 		System::TileScheduler): each tile is a contiguous, cache aligned block holding its red,
+	/// 		green, blue, sample count and luminance deviation channels one after the other, each
+	/// 		padded to a whole number of cache lines. Threads rendering different tiles thus never
+	/// 		write the same cache line. There is no lock: two threads must not write
+	/// 		the same pixel concurrently, and no other thread may read a tile while it is being
+	/// 		written (the display reads a copy of the finished tiles, see Scene::publishTile).
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	class Framebuffer
+	{
+	protected:
+		/// \brief	Number of 32 bits values in a cache line.
+		static const int s_cacheLineValues = 16 ;
+
+		/// \brief	The width in pixels.
+		int m_width ;
+		/// \brief	The height in pixels.
+		int m_height ;
+		/// \brief	The size of the (square) tiles.
+		int m_tileSize ;
+		/// \brief	The number of tiles on a row.
+		int m_tileColumns ;
+		/// \brief	Size of a channel of a tile (tileSize^2 rounded up to a cache line).
+		size_t m_channelSize ;
+		/// \brief	Number of channels of a tile.
+		static const int s_channels = 5 ;
+		/// \brief	The tiles: sum of the red, green and blue samples, the number of samples of each
+		/// 		pixel (exact up to 2^24 samples) and the sum of the squared deviations of the luminance
+		/// 		of the samples from their mean, updated with Welford's method (no cancellation).
+		::std::vector<float, aligned_allocator<float, 64> > m_data ;
+
+		/// \brief	Offset of the red channel of a pixel in m_data.
+		size_t offset(int x, int y) const
+		{
+			size_t tile = (size_t)(y/m_tileSize)*m_tileColumns + x/m_tileSize ;
+			return tile*s_channels*m_channelSize + (y%m_tileSize)*m_tileSize + x%m_tileSize ;
+		}
+
+		/// \brief	Number of samples stored at an offset given by Framebuffer::offset.
+		float & count(size_t offset)
+		{ return m_data[offset+3*m_channelSize] ; }
+
+		/// \brief	Number of samples stored at an offset given by Framebuffer::offset.
+		float count(size_t offset) const
+		{ return m_data[offset+3*m_channelSize] ; }
+
+		/// \brief	Luminance of the sum of the samples stored at an offset given by Framebuffer::offset.
+		float luminanceSum(size_t offset) const
+		{ return RGBColor(m_data[offset], m_data[offset+m_channelSize], m_data[offset+2*m_channelSize]).luminance() ; }
+
+	public:
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	Framebuffer::Framebuffer(int width=0, int height=0, int tileSize=16)
+		///
+		/// \brief	Constructor.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	width   	The width in pixels.
+		/// \param	height  	The height in pixels.
+		/// \param	tileSize	The size of the tiles.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		Framebuffer(int width=0, int height=0, int tileSize=16)
+		{
+			resize(width, height, tileSize) ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Framebuffer::resize(int width, int height, int tileSize)
+		///
+		/// \brief	Changes the size of the buffer and clears it.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	width   	The width in pixels.
+		/// \param	height  	The height in pixels.
+		/// \param	tileSize	The size of the tiles.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void resize(int width, int height, int tileSize)
+		{
+			m_width = width ;
+			m_height = height ;
+			m_tileSize = tileSize ;
+			m_tileColumns = (width+tileSize-1)/tileSize ;
+			int tileRows = (height+tileSize-1)/tileSize ;
+			m_channelSize = ((size_t)tileSize*tileSize+s_cacheLineValues-1)/s_cacheLineValues*s_cacheLineValues ;
+			m_data.assign((size_t)m_tileColumns*tileRows*s_channels*m_channelSize, 0.0f) ;
+		}
+
+		/// \brief	Removes all the samples.
+		void clear()
+		{
+			::std::fill(m_data.begin(), m_data.end(), 0.0f) ;
+		}
+
+		/// \brief	The width in pixels.
+		int width() const
+		{ return m_width ; }
+
+		/// \brief	The height in pixels.
+		int height() const
+		{ return m_height ; }
+
+		/// \brief	The size of the tiles.
+		int tileSize() const
+		{ return m_tileSize ; }
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Framebuffer::add(int x, int y, RGBColor const & sample)
+		///
+		/// \brief	Accumulates a sample in a pixel.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	x	  	The column of the pixel.
+		/// \param	y	  	The row of the pixel.
+		/// \param	sample	The sample.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void add(int x, int y, RGBColor const & sample)
+		{
+			size_t index = offset(x, y) ;
+			float samples = count(index) ;
+			// Welford's update: the luminance is linear, its mean is the luminance of the mean color
+			float meanBefore = samples==0.0f ? 0.0f : luminanceSum(index)/samples ;
+			m_data[index] += sample[0] ;
+			m_data[index+m_channelSize] += sample[1] ;
+			m_data[index+2*m_channelSize] += sample[2] ;
+			count(index) = samples+1.0f ;
+			float luminance = sample.luminance() ;
+			m_data[index+4*m_channelSize] += (luminance-meanBefore)*(luminance-luminanceSum(index)/(samples+1.0f)) ;
+		}
+
+		/// \brief	Number of samples accumulated in a pixel.
+		int sampleCount(int x, int y) const
+		{ return (int)count(offset(x, y)) ; }
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	RGBColor Framebuffer::pixel(int x, int y) const
+		///
+		/// \brief	Gets the average of the samples of a pixel (black if there is no sample).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	x	The column of the pixel.
+		/// \param	y	The row of the pixel.
+		///
+		/// \return	The color of the pixel.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		RGBColor pixel(int x, int y) const
+		{
+			size_t index = offset(x, y) ;
+			float samples = count(index) ;
+			if(samples==0.0f)
+			{
+				return RGBColor() ;
+			}
+			return RGBColor(m_data[index], m_data[index+m_channelSize], m_data[index+2*m_channelSize])/samples ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	float Framebuffer::error(int x, int y) const
+		///
+		/// \brief	Estimates the error of a pixel after tone mapping: the standard error of the mean
+		/// 		luminance l of its samples multiplied by the derivative 1/(1+l)^2 of the tone mapping
+		/// 		c/(1+c) of Visualizer::plot, in display units (1/255 is one level).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	x	The column of the pixel.
+		/// \param	y	The row of the pixel.
+		///
+		/// \return	The estimated error (infinite with less than two samples).
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		float error(int x, int y) const
+		{
+			size_t index = offset(x, y) ;
+			float samples = count(index) ;
+			if(samples<2.0f)
+			{
+				return ::std::numeric_limits<float>::infinity() ;
+			}
+			float mean = luminanceSum(index)/samples ;
+			float variance = ::std::max(m_data[index+4*m_channelSize]/(samples-1.0f), 0.0f) ;
+			return sqrtf(variance/samples)/((1.0f+mean)*(1.0f+mean)) ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Framebuffer::image(std::vector<unsigned char> & rgb) const
+		///
+		/// \brief	Gets the image with the tone mapping of Visualizer::plot: 8 bits red, green and blue
+		/// 		components of each pixel, row by row.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param [out]	rgb	The components of the pixels (3*width*height values).
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void image(::std::vector<unsigned char> & rgb) const
+		{
+			rgb.resize((size_t)3*m_width*m_height) ;
+			for(int y=0 ; y<m_height ; ++y)
+			{
+				for(int x=0 ; x<m_width ; ++x)
+				{
+					RGBColor color = pixel(x, y) ;
+					for(int c=0 ; c<3 ; ++c)
+					{
+						rgb[((size_t)y*m_width+x)*3+c] = (unsigned char)(color[c]/(color[c]+1)*255) ;
+					}
+				}
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	bool Framebuffer::writePPM(const char * fileName) const
+		///
+		/// \brief	Saves the image in a binary PPM file, with the tone mapping of Visualizer::plot (see
+		/// 		Framebuffer::image).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	fileName	The name of the file.
+		///
+		/// \return	false if the file cannot be written.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		bool writePPM(const char * fileName) const
+		{
+			FILE * file = fopen(fileName, "wb") ;
+			if(file==NULL)
+			{
+				return false ;
+			}
+			::std::vector<unsigned char> rgb ;
+			image(rgb) ;
+			fprintf(file, "P6\n%d %d\n255\n", m_width, m_height) ;
+			bool written = rgb.empty() || fwrite(&rgb[0], 1, rgb.size(), file)==rgb.size() ;
+			return fclose(file)==0 && written ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	bool Framebuffer::write(FILE * file) const
+		///
+		/// \brief	Writes the accumulated samples (all the channels, in the native binary format) in an
+		/// 		open file, to be read back by Framebuffer::read.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param [in,out]	file	The file, opened in binary mode.
+		///
+		/// \return	false if the file cannot be written.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		bool write(FILE * file) const
+		{
+			int header[4] = { m_width, m_height, m_tileSize, s_channels } ;
+			return fwrite(header, sizeof(int), 4, file)==4 && fwrite(&m_data[0], sizeof(float), m_data.size(), file)==m_data.size() ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	bool Framebuffer::read(FILE * file)
+		///
+		/// \brief	Reads samples written by Framebuffer::write. The size and the tile size of the file
+		/// 		must be the ones of this buffer, which is left unchanged otherwise.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param [in,out]	file	The file, opened in binary mode.
+		///
+		/// \return	false if the file cannot be read or does not match this buffer.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		bool read(FILE * file)
+		{
+			int header[4] ;
+			if(fread(header, sizeof(int), 4, file)!=4 || header[0]!=m_width || header[1]!=m_height || header[2]!=m_tileSize || header[3]!=s_channels)
+			{
+				return false ;
+			}
+			::std::vector<float, aligned_allocator<float, 64> > data(m_data.size()) ;
+			if(fread(&data[0], sizeof(float), data.size(), file)!=data.size())
+			{
+				return false ;
+			}
+			// Copied once complete: the buffer is left unchanged by a truncated file
+			::std::copy(data.begin(), data.end(), m_data.begin()) ;
+			return true ;
+		}
+	} ;
+}
+
+#endif
@@ -16,7 +16,7 @@ namespace Geometry
 	///
 	/// \brief	A 3D geometry.
 	///
-	/// \author	F. Lamarche, Universit de Rennes 1
+	/// \author	F. Lamarche, Université de Rennes 1
 	/// \date	04/12/2013
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	class Geometry
@@ -26,14 +26,20 @@ namespace Geometry
 	    std::deque<Math::Vector3, aligned_allocator<Math::Vector3, 16> > m_vertices ;
 		/// \brief	The triangles.
 		std::deque<Triangle, aligned_allocator<Triangle, 16> >      m_triangles ;
+		/// \brief	Incremented each time vertices are moved (see updateTriangles).
+		unsigned int m_vertexRevision ;
+		/// \brief	Incremented each time vertices or triangles are added.
+		unsigned int m_topologyRevision ;
 
 		////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// \fn	void Geometry::updateTriangles()
 		///
 		/// \brief	Updates all the triangles of the geometry (normals, u and v vectors). This method should
-		/// 		be called if some transformations arer applied on the vertices of the geometry.
+		/// 		be called if some transformations arer applied on the vertices of the geometry. It marks
+		/// 		the geometry as modified so that the acceleration structures are refitted (see
+		/// 		vertexRevision).
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		////////////////////////////////////////////////////////////////////////////////////////////////////
 		void updateTriangles()
@@ -42,6 +48,7 @@ namespace Geometry
 			{
 				m_triangles[cpt].update() ;
 			}
+			++m_vertexRevision ;
 		}
 
 		////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -49,7 +56,7 @@ namespace Geometry
 		///
 		/// \brief	Adds a triangle.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	i1					Zero-based index of the first vertex.
@@ -60,6 +67,7 @@ namespace Geometry
 		void addTriangle(int i1, int i2, int i3, Material * material)
 		{
 			m_triangles.push_back(Triangle(&m_vertices[i1], &m_vertices[i2], &m_vertices[i3], material)) ; 
+			++m_topologyRevision ;
 		}
 
 	public:
@@ -68,7 +76,7 @@ namespace Geometry
 		///
 		/// \brief	Gets the vertices.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \return	The vertices.
@@ -81,7 +89,7 @@ namespace Geometry
 		///
 		/// \brief	Gets the triangles.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \return	The triangles.
@@ -89,15 +97,64 @@ namespace Geometry
 		const std::deque<Triangle, aligned_allocator<Triangle, 16> > & getTriangles() const
 		{ return m_triangles ; }
 
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Geometry::setMaterialIds(std::map<const Material *, unsigned short> const & ids)
+		///
+		/// \brief	Sets the index of the material of each triangle in the material table of a scene (see
+		/// 		Scene::updateMaterials).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	ids	The index of each material of the geometry.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void setMaterialIds(::std::map<const Material *, unsigned short> const & ids)
+		{
+			for(int cpt=0 ; cpt<(int)m_triangles.size() ; cpt++)
+			{
+				m_triangles[cpt].setMaterialId(ids.find(m_triangles[cpt].material())->second) ;
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	unsigned int Geometry::vertexRevision() const
+		///
+		/// \brief	Gets the revision of the vertex positions: it changes each time the geometry is
+		/// 		transformed (translate, scale, rotate...). The bounds of an acceleration structure built
+		/// 		for another revision should be refitted.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \return	The revision.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		unsigned int vertexRevision() const
+		{ return m_vertexRevision ; }
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	unsigned int Geometry::topologyRevision() const
+		///
+		/// \brief	Gets the revision of the topology: it changes each time vertices or triangles are
+		/// 		added. An acceleration structure built for another revision must be rebuilt.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \return	The revision.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		unsigned int topologyRevision() const
+		{ return m_topologyRevision ; }
+
 		////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// \fn	Geometry::Geometry()
 		///
 		/// \brief	Default constructor.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		////////////////////////////////////////////////////////////////////////////////////////////////////
 		Geometry()
+			: m_vertexRevision(0), m_topologyRevision(0)
 		{}
 
 		////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -105,12 +162,13 @@ namespace Geometry
 		///
 		/// \brief	Copy constructor.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	10/12/2013
 		///
 		/// \param	geom	The geometry.
 		////////////////////////////////////////////////////////////////////////////////////////////////////
 		Geometry(const Geometry & geom)
+			: m_vertexRevision(0), m_topologyRevision(0)
 		{
 			merge(geom) ;
 		}
@@ -120,7 +178,7 @@ namespace Geometry
 		///
 		/// \brief	Adds a vertex.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	vertex	The vertex.
@@ -130,6 +188,7 @@ namespace Geometry
 		unsigned int addVertex(const Math::Vector3 & vertex)
 		{ 
 			m_vertices.push_back(vertex) ; 
+			++m_topologyRevision ;
 			return m_vertices.size()-1 ;
 		}
 
@@ -138,7 +197,7 @@ namespace Geometry
 		///
 		/// \brief	Adds a triangle.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	triangle	The triangle.
@@ -157,7 +216,7 @@ namespace Geometry
 		///
 		/// \brief	Adds a triangle.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	p0					The first vertex.
@@ -178,7 +237,7 @@ namespace Geometry
 		///
 		/// \brief	Merges the provided geometry with this one.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	geometry The geometry that should be merged
@@ -192,7 +251,6 @@ namespace Geometry
 				auto it = vectorToIndex.find(vertex) ;
 				if(it==vectorToIndex.end())
 				{
-					int index = addVertex(geometry.getVertices()[cpt]) ;
 					vectorToIndex.insert(::std::make_pair(vertex, addVertex(*vertex))) ;
 				}
 			}
@@ -211,7 +269,7 @@ namespace Geometry
 		///
 		/// \brief	Computes the intersection between this geometry and the provided Ray.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param [in,out]	ray	The ray.
@@ -236,7 +294,7 @@ namespace Geometry
 		///
 		/// \brief	Translate this geometry.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	t	The translation vector.
@@ -247,6 +305,7 @@ namespace Geometry
 			{
 				(*it) = (*it)+t ; 
 			}
+			updateTriangles() ;
 		}
 
 		////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -254,7 +313,7 @@ namespace Geometry
 		///
 		/// \brief	Applies a scale factor on this geometry.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	v	The scale factor.
@@ -273,7 +332,7 @@ namespace Geometry
 		///
 		/// \brief	Scales geometry on X axis.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	v	The scale factor on X axis.
@@ -292,7 +351,7 @@ namespace Geometry
 		///
 		/// \brief	Scales geometry on Y axis.
 		/// 		
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	v	The scale factor.
@@ -311,7 +370,7 @@ namespace Geometry
 		///
 		/// \brief	Scales the geometry on Z axis.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	v	The scale factor.
@@ -330,7 +389,7 @@ namespace Geometry
 		///
 		/// \brief	Rotates this geometry.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	q	Quaternion describing the rotation.
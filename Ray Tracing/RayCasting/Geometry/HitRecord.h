@@ -0,0 +1,164 @@
+#ifndef _Geometry_HitRecord_H
+#define _Geometry_HitRecord_H
+
+#include <Math/Vector3.h>
+#include <Math/RandomDirection.h>
+#include <Geometry/Ray.h>
+#include <Geometry/Triangle.h>
+#include <Geometry/Instance.h>
+#include <Geometry/Material.h>
+#include <Geometry/RayTriangleIntersection.h>
+
+namespace Geometry
+{
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \class	HitRecord
+	///
+	/// \brief	The shading data of a valid intersection, computed once when the ray hits a triangle and
+	/// 		then shared by all the shading code: the position of the hit, the normal of the triangle
+	/// 		oriented toward the viewer, the mirror reflection of the ray, an orthonormal basis around
+	/// 		the oriented normal (see Math::RandomDirection) and the components of the material. All
+	/// 		of them are in world space, the normal of a triangle of an instance being transformed
+	/// 		here. The record points to the triangle of the intersection and to the material, in the
+	/// 		material table of the scene (see Scene::updateMaterials), so it must not outlive the
+	/// 		rendering.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	class HitRecord
+	{
+	protected:
+		/// \brief	The position of the hit.
+		Math::Vector3 m_position ;
+		/// \brief	The normal of the triangle in world space, as oriented by its vertices.
+		Math::Vector3 m_geometricNormal ;
+		/// \brief	The geometric normal of the triangle, on the side of the incident ray.
+		Math::Vector3 m_normal ;
+		/// \brief	The mirror reflection of the direction of the incident ray.
+		Math::Vector3 m_reflected ;
+		/// \brief	First direction normal to m_normal.
+		Math::Vector3 m_tangent ;
+		/// \brief	Second direction normal to m_normal.
+		Math::Vector3 m_bitangent ;
+		/// \brief	The triangle hit by the ray (in the object space of its mesh for an instance).
+		const Triangle * m_triangle ;
+		/// \brief	The instance of the triangle (NULL if the triangle is not instanced).
+		const Instance * m_instance ;
+		/// \brief	The material of the triangle, in the material table of the scene.
+		const Material * m_material ;
+		/// \brief	The distance between the source of the ray and the hit.
+		float m_distance ;
+		/// \brief	The components of the material (combination of Material::Lobe).
+		int m_lobes ;
+
+	public:
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	HitRecord::HitRecord(Ray const & ray, RayTriangleIntersection const & intersection,
+		/// 	Material const & material)
+		///
+		/// \brief	Constructor.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	ray				The incident ray.
+		/// \param	intersection	A valid intersection of the ray.
+		/// \param	material		The material of the triangle of the intersection.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		HitRecord(Ray const & ray, RayTriangleIntersection const & intersection, Material const & material)
+			: m_triangle(intersection.triangle()), m_instance(intersection.instance()), m_material(&material), m_distance(intersection.tRayValue()), m_lobes(m_material->lobes())
+		{
+			const Math::Vector3 & direction = ray.direction() ;
+			m_position = ray.source()+direction*m_distance ;
+			if(m_instance!=NULL)
+			{ m_geometricNormal = m_triangle->transformedNormal(m_instance->toWorld()) ; }
+			else
+			{ m_geometricNormal = m_triangle->normal() ; }
+			m_normal = m_geometricNormal ;
+			if(m_normal*direction>0)
+			{ m_normal = -m_normal ; }
+			m_reflected = direction-m_normal*(2.0f*(direction*m_normal)) ;
+			Math::RandomDirection::orthonormalBasis(m_normal, m_tangent, m_bitangent) ;
+		}
+
+		/// \brief	The position of the hit.
+		const Math::Vector3 & position() const
+		{ return m_position ; }
+
+		/// \brief	The normal of the triangle in world space, as oriented by its vertices.
+		const Math::Vector3 & geometricNormal() const
+		{ return m_geometricNormal ; }
+
+		/// \brief	The geometric normal of the triangle, on the side of the incident ray.
+		const Math::Vector3 & normal() const
+		{ return m_normal ; }
+
+		/// \brief	The mirror reflection of the direction of the incident ray.
+		const Math::Vector3 & reflected() const
+		{ return m_reflected ; }
+
+		/// \brief	First direction normal to normal().
+		const Math::Vector3 & tangent() const
+		{ return m_tangent ; }
+
+		/// \brief	Second direction normal to normal().
+		const Math::Vector3 & bitangent() const
+		{ return m_bitangent ; }
+
+		/// \brief	The triangle hit by the ray (in the object space of its mesh for an instance).
+		const Triangle * triangle() const
+		{ return m_triangle ; }
+
+		/// \brief	The instance of the triangle (NULL if the triangle is not instanced).
+		const Instance * instance() const
+		{ return m_instance ; }
+
+		/// \brief	The material of the triangle, in the material table of the scene.
+		const Material * material() const
+		{ return m_material ; }
+
+		/// \brief	The distance between the source of the ray and the hit.
+		float distance() const
+		{ return m_distance ; }
+
+		/// \brief	The components of the material (combination of Material::Lobe).
+		int lobes() const
+		{ return m_lobes ; }
+
+		/// \brief	Does the material have the given component?
+		bool has(Material::Lobe lobe) const
+		{ return (m_lobes & lobe)!=0 ; }
+
+		/// \brief	Cosine distribution around the oriented normal, using the basis of the record.
+		Math::RandomDirection diffuseDirection() const
+		{ return Math::RandomDirection(m_normal, m_tangent, m_bitangent) ; }
+
+		/// \brief	The mirror reflection of a direction on the plane of the triangle.
+		Math::Vector3 reflectionDirection(Math::Vector3 const & dir) const
+		{ return dir-m_normal*(2.0f*(dir*m_normal)) ; }
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	Math::Vector3 HitRecord::refractionDirection(Ray const & ray) const
+		///
+		/// \brief	Computes the direction of the refracted ray, with the refraction index of the material
+		/// 		(see Triangle::refractionDirection).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	ray	The incident ray.
+		///
+		/// \return	The direction of the refracted ray.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		Math::Vector3 refractionDirection(Ray const & ray) const
+		{
+			float refraction = 1/m_material->indiceRefraction() ;
+			float alpha = m_normal*(-ray.direction()) ;
+			float beta = sqrt(1-pow(refraction, 2)*(1-pow(alpha, 2))) ;
+			return ray.direction()*refraction+m_normal*(refraction*alpha-beta) ;
+		}
+	} ;
+}
+
+#endif
@@ -0,0 +1,128 @@
+#ifndef _Geometry_Instance_H
+#define _Geometry_Instance_H
+
+#include <Geometry/BoundingBox.h>
+#include <Geometry/Material.h>
+#include <Geometry/Ray.h>
+#include <Math/Transform.h>
+
+namespace Geometry
+{
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \class	Instance
+	///
+	/// \brief	An occurrence of a shared mesh of the scene (see Scene::addMesh) placed by a transformation.
+	/// 		Rays are transformed in the object space of the mesh during the traversal, so that the
+	/// 		triangles and the hierarchy of the mesh are stored only once whatever the number of
+	/// 		instances. A material can override the materials of the mesh.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	class Instance
+	{
+	protected:
+		/// \brief	Object space to world space transformation.
+		Math::Transform m_toWorld ;
+		/// \brief	World space to object space transformation.
+		Math::Transform m_toObject ;
+		/// \brief	Index of the mesh in the scene.
+		int m_mesh ;
+		/// \brief	The material replacing the one of the triangles (NULL to keep the materials of the mesh).
+		Material * m_material ;
+		/// \brief	The index of m_material in the material table of the scene (see Scene::updateMaterials).
+		unsigned short m_materialId ;
+
+	public:
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	Instance::Instance(int mesh, Math::Transform const & toWorld, Material * material)
+		///
+		/// \brief	Constructor.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	mesh				Index of the mesh in the scene.
+		/// \param	toWorld				The object space to world space transformation.
+		/// \param [in,out]	material	If non-null, the material overriding the one of the mesh.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		Instance(int mesh, Math::Transform const & toWorld, Material * material)
+			: m_toWorld(toWorld), m_toObject(toWorld.inverse()), m_mesh(mesh), m_material(material), m_materialId(Material::s_noMaterial)
+		{}
+
+		/// \brief	Index of the mesh in the scene.
+		int mesh() const
+		{ return m_mesh ; }
+
+		/// \brief	The material overriding the one of the mesh (NULL if none).
+		Material * material() const
+		{ return m_material ; }
+
+		/// \brief	The index of the overriding material in the material table of the scene.
+		unsigned short materialId() const
+		{ return m_materialId ; }
+
+		/// \brief	Sets the index of the overriding material in the material table of the scene.
+		void setMaterialId(unsigned short materialId)
+		{ m_materialId = materialId ; }
+
+		/// \brief	Object space to world space transformation.
+		const Math::Transform & toWorld() const
+		{ return m_toWorld ; }
+
+		/// \brief	Sets the object space to world space transformation.
+		void setTransform(Math::Transform const & toWorld)
+		{
+			m_toWorld = toWorld ;
+			m_toObject = toWorld.inverse() ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	BoundingBox Instance::boundingBox(BoundingBox const & meshBox) const
+		///
+		/// \brief	Computes the world space box bounding the instance from the box of its mesh.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	meshBox	The object space bounding box of the mesh.
+		///
+		/// \return	The world space bounding box.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		BoundingBox boundingBox(BoundingBox const & meshBox) const
+		{
+			BoundingBox result ;
+			for(int corner=0 ; corner<8 ; ++corner)
+			{
+				Math::Vector3 point((corner&1) ? meshBox.maxVertex()[0] : meshBox.minVertex()[0],
+									(corner&2) ? meshBox.maxVertex()[1] : meshBox.minVertex()[1],
+									(corner&4) ? meshBox.maxVertex()[2] : meshBox.minVertex()[2]) ;
+				result.update(m_toWorld.transformPoint(point)) ;
+			}
+			return result ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	Ray Instance::objectRay(Ray const & ray, float & scale) const
+		///
+		/// \brief	Transforms a world space ray in the object space of the mesh. As ray directions are
+		/// 		normalized, a distance t along the world space ray becomes t*scale along the returned ray.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	ray			 	The world space ray.
+		/// \param [out]	scale	Ratio between the object space and the world space distances.
+		///
+		/// \return	The object space ray.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		Ray objectRay(Ray const & ray, float & scale) const
+		{
+			Math::Vector3 direction = m_toObject.transformVector(ray.direction()) ;
+			scale = direction.norm() ;
+			return Ray(m_toObject.transformPoint(ray.source()), direction) ;
+		}
+	} ;
+}
+
+#endif
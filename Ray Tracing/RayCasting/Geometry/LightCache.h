@@ -49,7 +49,7 @@ namespace Geometry
 		///
 		/// \brief	Default constructor.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	07/12/2013
 		////////////////////////////////////////////////////////////////////////////////////////////////////
 		LightCache()
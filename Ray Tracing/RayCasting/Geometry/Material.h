@@ -5,9 +5,26 @@
 
 namespace Geometry
 {
-	/** \brief Materiau associ  une gomtrie. */
+	/** \brief Materiau associé à une géométrie. 
+	La scene copie les materiaux de ses triangles dans une table compacte et leur attribue un indice
+	sur 16 bits, que les triangles stockent avec leurs donnees (voir Scene::updateMaterials) :
+	l'ombrage lit le materiau dans cette table contigue plutot qu'a travers le pointeur du triangle.
+	*/
 	class Material
 	{
+	public:
+		/** \brief Composantes (lobes) d'un materiau, combinees dans Material::lobes */
+		enum Lobe
+		{
+			diffuseLobe = 1,			///< Couleur diffuse non nulle
+			specularLobe = 2,			///< Couleur speculaire non nulle
+			emissiveLobe = 4,			///< Couleur emissive non nulle
+			refractiveLobe = 8			///< Indice de refraction non nul
+		} ;
+
+		/** \brief Indice d'un materiau absent de la table (voir Triangle::materialId) */
+		static const unsigned short s_noMaterial = 0xFFFF ;
+
 	protected:
 		RGBColor m_ambientColor ;
 		RGBColor m_diffuseColor ;
@@ -15,45 +32,59 @@ namespace Geometry
 		float    m_specularExponent ;
 		RGBColor m_emissiveColor ;
 		float	 m_indiceRefraction ;
+		int		 m_lobes ;
 
 	public:
 		/** \brief Contructeur de Material 
-		\param ambientColor		Composante ambiante du matriau
-		\param diffuseColor		Composante diffuse du mattriau
-		\param specularColor	Composante spculaire du matriau
-		\param specularExponent Exposant de la composante spculaire
-		\param emissiveColor	Composante missive du matriau
+		\param ambientColor		Composante ambiante du matériau
+		\param diffuseColor		Composante diffuse du matétriau
+		\param specularColor	Composante spéculaire du matériau
+		\param specularExponent Exposant de la composante spéculaire
+		\param emissiveColor	Composante émissive du matériau
 		\param indiceRefraction Indice de refraction du milieu
 		*/
 		Material(RGBColor const & ambientColor, RGBColor const & diffuseColor, 
 				 RGBColor specularColor, float specularExponent, RGBColor const & emissiveColor, float indiceRefraction)
 				 : m_ambientColor(ambientColor), m_diffuseColor(diffuseColor), m_specularColor(specularColor),
-				   m_specularExponent(specularExponent), m_emissiveColor(emissiveColor), m_indiceRefraction(indiceRefraction) 
-		{}
+				   m_specularExponent(specularExponent), m_emissiveColor(emissiveColor), m_indiceRefraction(indiceRefraction), m_lobes(0) 
+		{
+			if(m_diffuseColor!=0) m_lobes |= diffuseLobe ;
+			if(m_specularColor!=0) m_lobes |= specularLobe ;
+			if(m_emissiveColor!=0) m_lobes |= emissiveLobe ;
+			if(m_indiceRefraction!=0.0f) m_lobes |= refractiveLobe ;
+		}
 
-		/** \brief Sensibilit  la couleur ambiante */
+		/** \brief Sensibilité à la couleur ambiante */
 		const RGBColor & ambientColor() const
 		{ return m_ambientColor ; }
 
-		/** \brief Sensibilit  la couleur diffuse */
+		/** \brief Sensibilité à la couleur diffuse */
 		const RGBColor & diffuseColor() const
 		{ return m_diffuseColor ; }
 
-		/** \brief Sensibilit  la couleur spculaire */
+		/** \brief Sensibilité à la couleur spéculaire */
 		const RGBColor & specularColor() const
 		{ return m_specularColor ; }
 
-		/** \brief Exposant associ  la spcularit du matriau */
+		/** \brief Exposant associé à la spécularité du matériau */
 		const float & specularExponent() const
 		{ return m_specularExponent ; }
 
-		/** \brief Sensibilit  la couleur missive */
+		/** \brief Sensibilité à la couleur émissive */
 		const RGBColor & emissiveColor() const
 		{ return m_emissiveColor ; }
 
 		/** \brief Indice de refraction du milieu */
 		const float & indiceRefraction() const
 		{ return m_indiceRefraction ; }
+
+		/** \brief Composantes du materiau (combinaison de Material::Lobe) */
+		int lobes() const
+		{ return m_lobes ; }
+
+		/** \brief Le materiau a-t-il la composante lobe ? */
+		bool has(Lobe lobe) const
+		{ return (m_lobes & lobe)!=0 ; }
 	};
 }
 
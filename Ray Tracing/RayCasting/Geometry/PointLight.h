@@ -10,7 +10,7 @@ namespace Geometry
 	///
 	/// \brief	A point light.
 	///
-	/// \author	F. Lamarche, Universit de Rennes 1
+	/// \author	F. Lamarche, Université de Rennes 1
 	/// \date	04/12/2013
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	class PointLight
@@ -28,7 +28,7 @@ namespace Geometry
 		///
 		/// \brief	Constructor.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	position	The position.
@@ -43,7 +43,7 @@ namespace Geometry
 		///
 		/// \brief	Gets the light color.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \return	.
@@ -56,7 +56,7 @@ namespace Geometry
 		///
 		/// \brief	Gets the position of the light.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \return	.
@@ -69,7 +69,7 @@ namespace Geometry
 		///
 		/// \brief	Compute the color of an intersection lightened by this light.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	intersection A valid intersection between a ray and a triangle.
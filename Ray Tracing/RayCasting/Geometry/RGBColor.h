@@ -3,7 +3,7 @@
 
 namespace Geometry
 {
-	/** \brief Reprsentation d'une couleur */
+	/** \brief Représentation d'une couleur */
 
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// \class	RGBColor
@@ -11,7 +11,7 @@ namespace Geometry
 	/// \brief	A Red / Green / Blue color. Each component should be in range [0;1]. If a component 
 	/// 		value is greater than 1, rendering should be able to handle HDR.
 	///
-	/// \author	F. Lamarche, Universit de Rennes 1
+	/// \author	F. Lamarche, Université de Rennes 1
 	/// \date	04/12/2013
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	class RGBColor
@@ -27,7 +27,7 @@ namespace Geometry
 		///
 		/// \brief	Constructor.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	R	Red component.
@@ -49,7 +49,7 @@ namespace Geometry
 		///
 		/// \brief	Addition operator.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	c	The other color.
@@ -67,7 +67,7 @@ namespace Geometry
 		/// \brief	Multiplication operator. Multiplication is achieved by multiplying the two red components,
 		/// 		the two green components and the two blue components.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	c	The other rgb color.
@@ -84,7 +84,7 @@ namespace Geometry
 		///
 		/// \brief	Multiplies a color by a scalar value.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	v	The scalar.
@@ -101,7 +101,7 @@ namespace Geometry
 		///
 		/// \brief	Devides a color by a scalar value.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	v	The scalar.
@@ -118,7 +118,7 @@ namespace Geometry
 		///
 		/// \brief	Access to each color component. 0: red, 1: green, 2: blue.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	c	The index of the component.
@@ -135,7 +135,7 @@ namespace Geometry
 		///
 		/// \brief	Access to each color component. 0: red, 1: green, 2: blue.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	c	The index of the component.
@@ -147,6 +147,37 @@ namespace Geometry
 			return m_color[c] ;
 		}
 
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	float RGBColor::luminance() const
+		///
+		/// \brief	Gets the luminance of the color (Rec. 709 weights).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \return	The luminance.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		float luminance() const
+		{
+			return 0.2126f*m_color[0] + 0.7152f*m_color[1] + 0.0722f*m_color[2] ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	float RGBColor::maxComponent() const
+		///
+		/// \brief	Gets the highest of the three components.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \return	The highest component.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		float maxComponent() const
+		{
+			float result = (m_color[0]>m_color[1]) ? m_color[0] : m_color[1] ;
+			return (result>m_color[2]) ? result : m_color[2] ;
+		}
+
 		bool operator==(RGBColor const & color) const
 		{
 			return m_color[0]==color[0] && m_color[1]==color[1] && m_color[2]==color[2] ;
@@ -11,7 +11,7 @@ namespace Geometry
 	///
 	/// \brief	A ray with a source and a direction.
 	///
-	/// \author	F. Lamarche, Universit de Rennes 1
+	/// \author	F. Lamarche, Université de Rennes 1
 	/// \date	09/12/2013
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	class Ray
@@ -30,7 +30,7 @@ namespace Geometry
 		///
 		/// \brief	Constructor.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	09/12/2013
 		///
 		/// \param	source   	The source of the ray.
@@ -50,7 +50,7 @@ namespace Geometry
 		///
 		/// \brief	Gets the source of the ray.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	09/12/2013
 		///
 		/// \return	.
@@ -63,7 +63,7 @@ namespace Geometry
 		///
 		/// \brief	Gets the direction of the ray.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	09/12/2013
 		///
 		/// \return	.
@@ -77,7 +77,7 @@ namespace Geometry
 		/// \brief	Gets the inverse direction of the ray (1.0/dx, 1.0/dy, 1.0/dz). Useful for ray box 
 		/// 		intersection computation.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	09/12/2013
 		///
 		/// \return	.
@@ -93,7 +93,7 @@ namespace Geometry
 		///
 		/// \brief	Projects a point on the ray.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	09/12/2013
 		///
 		/// \param	point		 	The point.
@@ -112,7 +112,7 @@ namespace Geometry
 		/// \brief	Gets a three dimensional array containing the sign of each coordinate (1 if negative, 
 		/// 		0 if positive).
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	10/12/2013
 		///
 		/// \return	null if it fails, else the sign.
@@ -8,12 +8,14 @@
 
 namespace Geometry
 {
+	class Instance ;
+
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// \class	RayTriangleIntersection
 	///
 	/// \brief	An intersection between a ray and a triangle.
 	///
-	/// \author	F. Lamarche, Universit de Rennes 1
+	/// \author	F. Lamarche, Université de Rennes 1
 	/// \date	04/12/2013
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	class RayTriangleIntersection
@@ -27,8 +29,11 @@ namespace Geometry
 		float m_v ;
 		/// \brief	Is the intersection valid?
 		bool m_valid ;
-		/// \brief	The triangle associated to the intersection.
+		/// \brief	The triangle associated to the intersection (in the object space of its mesh for an
+		/// 		instance).
 		const Triangle * m_triangle ;
+		/// \brief	The instance of the triangle (NULL if the triangle is not instanced).
+		const Instance * m_instance ;
 		/// \brief	The ray associated to the intersection.
 		const Ray * m_ray ;
 
@@ -39,30 +44,72 @@ namespace Geometry
 		///
 		/// \brief	Constructor.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	triangle	The triangle.
 		/// \param	ray			The ray.
 		////////////////////////////////////////////////////////////////////////////////////////////////////
 		RayTriangleIntersection(const Triangle * triangle, const Ray * ray)
-			: m_triangle(triangle), m_ray(ray)
+			: m_triangle(triangle), m_instance(NULL), m_ray(ray)
 		{
 			m_valid=triangle->intersection(*ray, m_t, m_u, m_v) ;
 		}
 
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	RayTriangleIntersection::RayTriangleIntersection(const Triangle * triangle,
+		/// 	const Ray * ray, float t, float u, float v)
+		///
+		/// \brief	Constructor of a valid intersection that has already been computed (for instance during
+		/// 		the traversal of an acceleration structure).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	triangle	The triangle.
+		/// \param	ray			The ray.
+		/// \param	t			The distance between the ray source and the intersection.
+		/// \param	u			The u coordinate of the intersection.
+		/// \param	v			The v coordinate of the intersection.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		RayTriangleIntersection(const Triangle * triangle, const Ray * ray, float t, float u, float v)
+			: m_t(t), m_u(u), m_v(v), m_valid(true), m_triangle(triangle), m_instance(NULL), m_ray(ray)
+		{}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	RayTriangleIntersection::RayTriangleIntersection(const Triangle * triangle,
+		/// 	const Instance * instance, const Ray * ray, float t, float u, float v)
+		///
+		/// \brief	Constructor of a valid intersection with a triangle of an instance. The triangle stays
+		/// 		in the object space of its mesh, the shading data is computed in world space by
+		/// 		HitRecord.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	triangle	The triangle, in the object space of the mesh of the instance.
+		/// \param	instance	The instance.
+		/// \param	ray			The ray, in world space.
+		/// \param	t			The distance between the ray source and the intersection.
+		/// \param	u			The u coordinate of the intersection.
+		/// \param	v			The v coordinate of the intersection.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		RayTriangleIntersection(const Triangle * triangle, const Instance * instance, const Ray * ray, float t, float u, float v)
+			: m_t(t), m_u(u), m_v(v), m_valid(true), m_triangle(triangle), m_instance(instance), m_ray(ray)
+		{}
+
 		////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// \fn	RayTriangleIntersection::RayTriangleIntersection(const Ray * ray)
 		///
 		/// \brief	Constructor that constructs an invalid intersection.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	ray	The ray.
 		////////////////////////////////////////////////////////////////////////////////////////////////////
 		RayTriangleIntersection(const Ray * ray)
-			: m_valid(false), m_triangle(NULL), m_ray(ray)
+			: m_valid(false), m_triangle(NULL), m_instance(NULL), m_ray(ray)
 		{}
 
 		////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -70,7 +117,7 @@ namespace Geometry
 		///
 		/// \brief	Is the intersection valid?
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \return	true if valid, false otherwise.
@@ -83,7 +130,7 @@ namespace Geometry
 		///
 		/// \brief	Distance between the ray source and the intersection point
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \return	.
@@ -96,7 +143,7 @@ namespace Geometry
 		///
 		/// \brief	The u value of the intersection.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \return	.
@@ -109,7 +156,7 @@ namespace Geometry
 		///
 		/// \brief	The v value of the intersection
 		/// 		
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \return	.
@@ -122,7 +169,7 @@ namespace Geometry
 		///
 		/// \brief	Returns the triangle associated to the intersection.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \return	The triangle.
@@ -130,12 +177,25 @@ namespace Geometry
 		const Triangle * triangle() const
 		{ return m_triangle ; }
 
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	const Instance * RayTriangleIntersection::instance() const
+		///
+		/// \brief	Returns the instance of the triangle.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \return	The instance, NULL if the triangle is not instanced (it is then in world space).
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		const Instance * instance() const
+		{ return m_instance ; }
+
 		////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// \fn	const Ray * RayTriangleIntersection::ray() const
 		///
 		/// \brief	Return the ray associated to the intersection.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \return	The ray.
@@ -148,7 +208,7 @@ namespace Geometry
 		///
 		/// \brief	Returns the intersection point.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \return	.
@@ -161,7 +221,7 @@ namespace Geometry
 		///
 		/// \brief	Compares two intersections associated with the same ray (otherwise, it is a non-sense)
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	i	Zero-based index of the.
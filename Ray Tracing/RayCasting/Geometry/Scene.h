@@ -1,19 +1,43 @@
 #ifndef _Geometry_Scene_H
 #define _Geometry_Scene_H
 
+#ifdef _WIN32
 #include <windows.h>
+#endif
 #include <Geometry/Geometry.h>
 #include <Geometry/PointLight.h>
 #include <Visualizer/Visualizer.h>
 #include <Geometry/Camera.h>
 #include <Geometry/BoundingBox.h>
+#include <Geometry/WideBVH.h>
+#include <Geometry/TriangleBVH.h>
+#include <Geometry/Instance.h>
 #include <Math/RandomDirection.h>
+#include <Math/Random.h>
+#include <Math/AliasTable.h>
+#include <Math/IndependentSampler.h>
+#include <Math/SobolSampler.h>
+#include <Math/BlueNoiseSampler.h>
 #include <math.h>
-#include <windows.h>
 #include <Geometry/CastedRay.h>
+#include <Geometry/HitRecord.h>
 #include <System/aligned_allocator.h>
+#include <System/TileScheduler.h>
+#include <System/Profiler.h>
+#include <System/RayStatistics.h>
+#include <Geometry/Framebuffer.h>
 #include <deque>
+#include <map>
+#include <stdexcept>
+#include <vector>
 #include <limits>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <chrono>
+#include <string>
+#include <cstdio>
+#include <cstring>
 
 using namespace std;
 
@@ -26,14 +50,77 @@ namespace Geometry
 	/// 		allowing to add geometry, lights and a camera are provided. Scene rendering is achieved by
 	/// 		calling the Scene::compute method.
 	///
-	/// \author	F. Lamarche, Universit de Rennes 1
+	/// \author	F. Lamarche, Université de Rennes 1
 	/// \date	03/12/2013
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	class Scene
 	{
+	public:
+		/// \brief	Integrators available for Scene::compute.
+		enum Integrator
+		{
+			/// \brief	Each hit spawns nbRandomRay diffuse and nbRandomRay specular rays (see sendRay).
+			recursiveIntegrator,
+			/// \brief	One path per sample terminated by russian roulette, nbRandomRay samples per pixel
+			/// 		(see tracePath).
+			pathTracingIntegrator
+		};
+
+		/// \brief	Samplers of the pixel and path dimensions (see Scene::setSampler).
+		enum SamplerType
+		{
+			/// \brief	Independent uniform values (Math::IndependentSampler), the reference.
+			independentSampler,
+			/// \brief	Owen scrambled Sobol sequence (Math::SobolSampler).
+			sobolSampler,
+			/// \brief	Sobol sequence dithered by a blue noise mask (Math::BlueNoiseSampler).
+			blueNoiseSampler
+		};
+
 	protected:
-		/// \brief	The visualizer (rendering target).
+		/// \brief	Number of bounces after which paths are terminated by russian roulette.
+		static const int s_russianRouletteDepth = 3;
+		/// \brief	Number of samples of every pixel before its error is first estimated (adaptive sampling).
+		static const int s_adaptiveMinSamples = 16;
+		/// \brief	Number of samples added to the unconverged pixels at each adaptive pass.
+		static const int s_adaptiveBatch = 8;
+		/// \brief	Identifier of the checkpoint files ("RTCK").
+		static const int s_checkpointMagic = 0x4b435452;
+		/// \brief	Version of the checkpoint files.
+		static const int s_checkpointVersion = 2;
+
+		/// \brief	Header of a checkpoint file (see Scene::setCheckpoint), followed by the framebuffer
+		/// 		(see Framebuffer::write). The first fields identify the rendering: they must match to
+		/// 		resume it.
+		struct Checkpoint
+		{
+			int magic, version;
+			int integrator, sampler, maxDepth, nbRandomRay;
+			unsigned int seed;
+			float adaptiveError;
+			/// \brief	Hash of the scene and of the camera (see Scene::sceneHash).
+			unsigned long long scene;
+			/// \brief	Number of passes rendered.
+			int pass;
+			/// \brief	Number of samples of the pixels sampled by every pass, the index of the next sample.
+			int samples;
+			/// \brief	Number of samples of all the pixels.
+			long long totalSamples;
+			/// \brief	Rendering time of all the runs in seconds.
+			double elapsedTime;
+		};
+
+		/// \brief	The visualizer displaying the rendering (NULL in headless mode).
 		Visualizer::Visualizer * m_visu;
+		/// \brief	The rendering target, written by the rendering threads.
+		Framebuffer m_framebuffer;
+		/// \brief	Period of the display refresh in milliseconds.
+		int m_displayPeriod;
+		/// \brief	The pixels shown by the visualizer, copied from the framebuffer when a tile is finished
+		/// 		(see Scene::publishTile).
+		std::vector<RGBColor> m_displayImage;
+		/// \brief	Protects m_displayImage, shared by the rendering threads and the display thread.
+		std::mutex m_displayMutex;
 		/// \brief	The scene geometry (basic representation without any optimization).
 		std::deque<std::pair<BoundingBox, Geometry> > m_geometries;
 		//Geometry m_geometry;
@@ -41,6 +128,129 @@ namespace Geometry
 		std::deque<PointLight, aligned_allocator<PointLight, 16> > m_lights;
 		/// \brief	The camera.
 		Camera m_camera;
+		/// \brief	Bottom level acceleration structures: one bounding volume hierarchy per geometry.
+		std::deque<TriangleBVH> m_geometryBVHs;
+		/// \brief	The meshes shared by the instances (not rendered by themselves) and their bounding boxes.
+		std::deque<std::pair<BoundingBox, Geometry> > m_meshes;
+		/// \brief	Bottom level acceleration structures of the meshes.
+		std::deque<TriangleBVH> m_meshBVHs;
+		/// \brief	The instances of the meshes and their world space bounding boxes.
+		std::deque<std::pair<BoundingBox, Instance> > m_instances;
+		/// \brief	Top level acceleration structure: hierarchy over the bounding boxes of the geometries
+		/// 		followed by the ones of the instances.
+		SceneBVH m_topLevelBVH;
+		/// \brief	Is the top level hierarchy up to date with the bounding boxes of the geometries?
+		bool m_topLevelUpToDate;
+		/// \brief	Copies of the materials of the triangles, indexed by Triangle::materialId (see
+		/// 		Scene::updateMaterials). Only modified between two renderings.
+		std::vector<Material> m_materials;
+		/// \brief	Are the indices of the materials up to date with the geometries and the instances?
+		bool m_materialsUpToDate;
+		/// \brief	Build algorithm of the bottom level hierarchies.
+		BVH::BuildMode m_buildMode;
+		/// \brief	Maximum degradation of a refitted hierarchy before it is rebuilt (see TriangleBVH::refit).
+		float m_maxRefitDegradation;
+		/// \brief	The integrator used by Scene::compute.
+		Integrator m_integrator;
+		/// \brief	The sampler used by the path tracing integrator.
+		SamplerType m_samplerType;
+		/// \brief	Global seed of the random sequences (see Scene::setSeed).
+		unsigned int m_seed;
+		/// \brief	World space copies of the emissive triangles (see Scene::updateLights).
+		std::vector<Triangle, aligned_allocator<Triangle, 16> > m_emissiveTriangles;
+		/// \brief	Distribution of the emissive triangles, proportional to their area times their luminance.
+		Math::AliasTable m_lightTable;
+		/// \brief	Number of rendering threads (0: OpenMP default).
+		int m_threadCount;
+		/// \brief	Maximum number of samples of a pixel with progressive rendering (0: progressive
+		/// 		rendering disabled, see Scene::setProgressiveRendering).
+		int m_progressiveMaxSamples;
+		/// \brief	Rendering time after which progressive rendering stops, in seconds (0: unlimited).
+		double m_progressiveTimeBudget;
+		/// \brief	Root mean square of the pixel errors under which progressive rendering stops (0: none).
+		float m_progressiveError;
+		/// \brief	Error under which a pixel is no longer sampled (0: adaptive sampling disabled).
+		float m_adaptiveError;
+		/// \brief	File where the progressive rendering is saved (empty: no checkpoint).
+		std::string m_checkpointFile;
+		/// \brief	Minimum time between two checkpoints in seconds.
+		double m_checkpointPeriod;
+		/// \brief	File where the profile of each rendering is written (empty: no profiling).
+		std::string m_profileFile;
+		/// \brief	Are the ray statistics of each rendering printed?
+		bool m_rayStatistics;
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \class	GeometryIntersector
+		///
+		/// \brief	Intersector used during the traversal of the top level hierarchy: forwards the ray to
+		/// 		the bottom level hierarchy of each geometry whose bounding box is reached. For an
+		/// 		instance, the ray is first transformed in the object space of its mesh.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		template <class TriangleIntersector>
+		class GeometryIntersector
+		{
+		protected:
+			const std::deque<TriangleBVH> & m_geometryBVHs;
+			const std::deque<TriangleBVH> & m_meshBVHs;
+			const std::deque<std::pair<BoundingBox, Instance> > & m_instances;
+			const Ray & m_ray;
+			TriangleIntersector & m_intersector;
+
+		public:
+			GeometryIntersector(Scene const & scene, const Ray & ray, TriangleIntersector & intersector)
+				: m_geometryBVHs(scene.m_geometryBVHs), m_meshBVHs(scene.m_meshBVHs), m_instances(scene.m_instances), m_ray(ray), m_intersector(intersector)
+			{}
+
+			bool operator() (int geometry, float & tMax)
+			{
+				if(geometry < (int)m_geometryBVHs.size())
+					return m_geometryBVHs[geometry].traverse(m_ray, tMax, m_intersector);
+
+				// Instance : le rayon est exprime dans le repere du maillage partage
+				const Instance & instance = m_instances[geometry - m_geometryBVHs.size()].second;
+				float scale;
+				Ray objectRay = instance.objectRay(m_ray, scale);
+				float objectTMax = tMax * scale;
+				const float initialTMax = objectTMax;
+				m_intersector.setInstance(&instance);
+				bool stop = m_meshBVHs[instance.mesh()].traverse(objectRay, objectTMax, m_intersector);
+				m_intersector.setInstance(NULL);
+				if(objectTMax < initialTMax)
+					tMax = objectTMax / scale;
+				return stop;
+			}
+
+			void visitNodes(int count)
+			{
+				m_intersector.visitNodes(count);
+			}
+		};
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	template <class TriangleIntersector> bool Scene::traverse(Ray const & ray, float & tMax,
+		/// 	TriangleIntersector & intersector)
+		///
+		/// \brief	Traverses the two levels of the acceleration structure (see TriangleBVH::traverse).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	ray						The ray.
+		/// \param [in,out]	tMax			The maximum distance of interest along the ray.
+		/// \param [in,out]	intersector		The triangle intersector.
+		///
+		/// \return	true if the traversal has been stopped by the intersector.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		template <class TriangleIntersector>
+		bool traverse(Ray const & ray, float & tMax, TriangleIntersector & intersector) const
+		{
+			assert(m_topLevelUpToDate);
+			GeometryIntersector<TriangleIntersector> geometryIntersector(*this, ray, intersector);
+			return m_topLevelBVH.traverse(ray, tMax, geometryIntersector);
+		}
 
 	public:
 
@@ -49,21 +259,57 @@ namespace Geometry
 		///
 		/// \brief	Constructor.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		///
-		/// \param [in,out]	visu	If non-null, the visu.
+		/// \param [in,out]	visu	The visualizer displaying the rendering (its size is the size of the image).
 		////////////////////////////////////////////////////////////////////////////////////////////////////
 		Scene(Visualizer::Visualizer * visu)
-			: m_visu(visu)
+			: m_visu(visu), m_framebuffer(visu->width(), visu->height()), m_displayPeriod(100), m_topLevelUpToDate(false), m_materialsUpToDate(false), m_buildMode(BVH::highQualityBuild), m_maxRefitDegradation(1.5f), m_integrator(recursiveIntegrator), m_samplerType(independentSampler), m_seed(0), m_threadCount(0), m_progressiveMaxSamples(0), m_progressiveTimeBudget(0.0), m_progressiveError(0.0f), m_adaptiveError(0.0f), m_checkpointPeriod(60.0), m_rayStatistics(false)
 		{}
 
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	Scene::Scene(int width, int height)
+		///
+		/// \brief	Constructor of a headless scene: the rendering is only stored in the framebuffer (see
+		/// 		Scene::framebuffer).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	width 	The width of the image.
+		/// \param	height	The height of the image.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		Scene(int width, int height)
+			: m_visu(NULL), m_framebuffer(width, height), m_displayPeriod(100), m_topLevelUpToDate(false), m_materialsUpToDate(false), m_buildMode(BVH::highQualityBuild), m_maxRefitDegradation(1.5f), m_integrator(recursiveIntegrator), m_samplerType(independentSampler), m_seed(0), m_threadCount(0), m_progressiveMaxSamples(0), m_progressiveTimeBudget(0.0), m_progressiveError(0.0f), m_adaptiveError(0.0f), m_checkpointPeriod(60.0), m_rayStatistics(false)
+		{}
+
+		/// \brief	The framebuffer holding the last rendering.
+		const Framebuffer & framebuffer() const
+		{ return m_framebuffer; }
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Scene::setDisplayPeriod(int milliseconds)
+		///
+		/// \brief	Sets the period at which the visualizer is refreshed during the rendering (100ms by
+		/// 		default). Ignored in headless mode.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	milliseconds	The period in milliseconds.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void setDisplayPeriod(int milliseconds)
+		{
+			m_displayPeriod = milliseconds;
+		}
+
 		////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// \fn	void Scene::add(const Geometry & geometry)
 		///
 		/// \brief	Adds a geometry to the scene.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		///
 		/// \param	geometry The geometry to add.
@@ -73,6 +319,461 @@ namespace Geometry
 			//m_geometry.merge(geometry) 
 			BoundingBox box(geometry);
 			m_geometries.push_back(::std::make_pair(box, geometry));
+			m_geometryBVHs.push_back(TriangleBVH());
+			m_topLevelUpToDate = false;
+			m_materialsUpToDate = false;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	int Scene::addMesh(const Geometry & geometry)
+		///
+		/// \brief	Adds a mesh that can be shared by several instances (see Scene::addInstance). The mesh
+		/// 		itself is not rendered.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	geometry	The geometry of the mesh (in object space).
+		///
+		/// \return	The index of the mesh.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		int addMesh(const Geometry & geometry)
+		{
+			BoundingBox box(geometry);
+			m_meshes.push_back(::std::make_pair(box, geometry));
+			m_meshBVHs.push_back(TriangleBVH());
+			m_materialsUpToDate = false;
+			return (int)m_meshes.size() - 1;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	Geometry & Scene::getMesh(int index)
+		///
+		/// \brief	Gets a mesh in order to modify it between two renderings: all its instances follow the
+		/// 		modification (see Scene::getGeometry).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	index	Index of the mesh.
+		///
+		/// \return	The geometry of the mesh.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		Geometry & getMesh(int index)
+		{
+			return m_meshes[index].second;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	int Scene::addInstance(int mesh, Math::Transform const & transform, Material * material)
+		///
+		/// \brief	Adds an instance of a mesh: only the transformation is stored, the triangles and the
+		/// 		hierarchy of the mesh are shared.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	mesh				Index of the mesh (see Scene::addMesh).
+		/// \param	transform			The object space to world space transformation.
+		/// \param [in,out]	material	If non-null, the material overriding the ones of the mesh.
+		///
+		/// \return	The index of the instance.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		int addInstance(int mesh, Math::Transform const & transform, Material * material = NULL)
+		{
+			Instance instance(mesh, transform, material);
+			m_instances.push_back(::std::make_pair(instance.boundingBox(m_meshes[mesh].first), instance));
+			m_topLevelUpToDate = false;
+			m_materialsUpToDate = false;
+			return (int)m_instances.size() - 1;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Scene::setInstanceTransform(int index, Math::Transform const & transform)
+		///
+		/// \brief	Moves an instance between two renderings (only the top level hierarchy is rebuilt).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	index	 	Index of the instance.
+		/// \param	transform	The new object space to world space transformation.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void setInstanceTransform(int index, Math::Transform const & transform)
+		{
+			Instance & instance = m_instances[index].second;
+			instance.setTransform(transform);
+			m_instances[index].first = instance.boundingBox(m_meshes[instance.mesh()].first);
+			m_topLevelUpToDate = false;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	Geometry & Scene::getGeometry(int index)
+		///
+		/// \brief	Gets a geometry of the scene (in the order of the calls to Scene::add) in order to move
+		/// 		it between two renderings. Transformations (translate, rotate, scale...) are detected
+		/// 		by the next call to Scene::compute, which refits the hierarchy of the geometry.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	index	Zero-based index of the geometry.
+		///
+		/// \return	The geometry.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		Geometry & getGeometry(int index)
+		{
+			return m_geometries[index].second;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Scene::updateGeometry(int index)
+		///
+		/// \brief	Forces the rebuild of the hierarchy of a geometry by the next call to Scene::compute
+		/// 		(transformations of the geometry only lead to a refit, see Scene::updateBVH).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	index	Zero-based index of the geometry.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void updateGeometry(int index)
+		{
+			m_geometryBVHs[index].invalidate();
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Scene::setMaxRefitDegradation(float maxDegradation)
+		///
+		/// \brief	Sets the maximum ratio between the SAH cost of a refitted hierarchy and its cost right
+		/// 		after the build. A geometry whose hierarchy degrades past this ratio is rebuilt (default
+		/// 		1.5).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	maxDegradation	The maximum ratio (1 rebuilds a hierarchy as soon as a refit increases its
+		/// 						cost, a translation keeps the cost and is always refitted).
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void setMaxRefitDegradation(float maxDegradation)
+		{
+			m_maxRefitDegradation = maxDegradation;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Scene::setBuildMode(BVH::BuildMode mode)
+		///
+		/// \brief	Selects the build algorithm of the hierarchies of the geometries: BVH::fastBuild
+		/// 		(parallel linear BVH, short time to first pixel) or BVH::highQualityBuild (binned SAH,
+		/// 		faster rendering). The hierarchies are rebuilt by the next call to Scene::compute.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	mode	The build algorithm.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void setBuildMode(BVH::BuildMode mode)
+		{
+			if(mode == m_buildMode)
+				return;
+			m_buildMode = mode;
+			for(int i = 0; i < (int)m_geometryBVHs.size(); i++)
+			{
+				m_geometryBVHs[i].invalidate();
+			}
+			for(int i = 0; i < (int)m_meshBVHs.size(); i++)
+			{
+				m_meshBVHs[i].invalidate();
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Scene::setIntegrator(Integrator integrator)
+		///
+		/// \brief	Selects the integrator used by Scene::compute (recursiveIntegrator by default).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	integrator	The integrator.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void setIntegrator(Integrator integrator)
+		{
+			m_integrator = integrator;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Scene::setSampler(SamplerType sampler)
+		///
+		/// \brief	Selects the sampler generating the pixel jitter, the light selection and the BRDF
+		/// 		sampling of each bounce with the path tracing integrator (and the jitter of adaptive
+		/// 		sampling). independentSampler, the default, is the reference.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	sampler	The sampler.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void setSampler(SamplerType sampler)
+		{
+			m_samplerType = sampler;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Scene::setSeed(unsigned int seed)
+		///
+		/// \brief	Sets the global seed of the random sequences of the samplers and of the integrators
+		/// 		(0 by default). A rendering only depends on the scene, its parameters and the seed,
+		/// 		not on the number of threads: renderings with the same seed are identical.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	seed	The seed.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void setSeed(unsigned int seed)
+		{
+			m_seed = seed;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Scene::setThreadCount(int threadCount)
+		///
+		/// \brief	Sets the number of rendering threads (0, the default, uses the OpenMP default).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	threadCount	The number of threads.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void setThreadCount(int threadCount)
+		{
+			m_threadCount = threadCount;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Scene::setTileSize(int tileSize)
+		///
+		/// \brief	Sets the size of the square tiles distributed to the rendering threads (16 by default,
+		/// 		see System::TileScheduler).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	tileSize	The size of the tiles in pixels.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void setTileSize(int tileSize)
+		{
+			m_framebuffer.resize(m_framebuffer.width(), m_framebuffer.height(), tileSize);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Scene::setProgressiveRendering(int maxSamples, double timeBudget, float targetError = 0.0f)
+		///
+		/// \brief	Enables progressive rendering: Scene::compute renders successive passes of jittered
+		/// 		samples of every pixel (s_adaptiveMinSamples, then s_adaptiveBatch per pass) in the
+		/// 		framebuffer, until maxSamples samples per pixel, until the next pass would exceed the
+		/// 		time budget (its duration is estimated from the previous pass) or until the root mean
+		/// 		square of the pixel errors (see Framebuffer::error) is below targetError.
+		/// 		With the path tracing integrator, nbRandomRay is then ignored. The rendering can be
+		/// 		saved periodically and resumed (see Scene::setCheckpoint).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	maxSamples 	The maximum number of samples of a pixel, 0 disables progressive rendering.
+		/// \param	timeBudget 	The rendering time budget in seconds (0: unlimited).
+		/// \param	targetError	The target error of the image in display units (0: none).
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void setProgressiveRendering(int maxSamples, double timeBudget, float targetError = 0.0f)
+		{
+			m_progressiveMaxSamples = maxSamples;
+			m_progressiveTimeBudget = timeBudget;
+			m_progressiveError = targetError;
+			m_adaptiveError = 0.0f;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Scene::setAdaptiveSampling(float targetError, int maxSamples, double timeBudget = 0.0)
+		///
+		/// \brief	Enables adaptive sampling, a progressive rendering (see
+		/// 		Scene::setProgressiveRendering) where the passes after the first one only sample the
+		/// 		pixels whose estimated error (see Framebuffer::error), or the one of a neighbour, is
+		/// 		above targetError, until every pixel has converged or reached maxSamples, or until the
+		/// 		time budget is spent. With the recursive integrator, each sample still spawns
+		/// 		nbRandomRay rays per hit; with the path tracing integrator, the number of paths per
+		/// 		pixel is chosen adaptively and nbRandomRay is ignored.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	targetError	The target error in display units (e.g. 1/255), 0 disables adaptive sampling.
+		/// \param	maxSamples 	The maximum number of samples of a pixel.
+		/// \param	timeBudget 	The rendering time budget in seconds (0: unlimited).
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void setAdaptiveSampling(float targetError, int maxSamples, double timeBudget = 0.0)
+		{
+			setProgressiveRendering(targetError > 0.0f ? maxSamples : 0, timeBudget);
+			m_adaptiveError = targetError;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Scene::setCheckpoint(std::string const & fileName, double period = 60.0)
+		///
+		/// \brief	Saves the progressive rendering (framebuffer and pass state) in a file after the pass
+		/// 		ending each period and at the end of the rendering. If the file exists when
+		/// 		Scene::compute starts a progressive rendering with the same size, integrator, sampler,
+		/// 		parameters, scene and camera (see Scene::sceneHash), the rendering resumes where it was
+		/// 		saved: an interrupted job only loses
+		/// 		the passes rendered since the last checkpoint. The samples being indexed, the resumed
+		/// 		rendering is identical to an uninterrupted one. The file is replaced atomically, a
+		/// 		job killed while saving keeps the previous checkpoint.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	fileName	The name of the file (empty: no checkpoint).
+		/// \param	period  	The minimum time between two checkpoints in seconds.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void setCheckpoint(std::string const & fileName, double period = 60.0)
+		{
+			m_checkpointFile = fileName;
+			m_checkpointPeriod = period;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Scene::setProfiling(std::string const & fileName)
+		///
+		/// \brief	Enables the profiling of the renderings (see System::Profiler): at the end of each
+		/// 		Scene::compute, the time spent by the threads in the BVH update, the primary, shadow
+		/// 		and indirect rays, the shading and the framebuffer output is written in a JSON report,
+		/// 		or a CSV one if the name ends with ".csv".
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	fileName	The name of the report (empty: no profiling).
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void setProfiling(std::string const & fileName)
+		{
+			m_profileFile = fileName;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Scene::setRayStatistics(bool enabled)
+		///
+		/// \brief	Enables the ray statistics (see System::RayStatistics): at the end of each
+		/// 		Scene::compute, the number of primary, shadow, diffuse, specular and refracted rays, their
+		/// 		throughput, the nodes and triangles tested per ray and the histogram of the path lengths
+		/// 		are printed.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	enabled	true to count the rays.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void setRayStatistics(bool enabled)
+		{
+			m_rayStatistics = enabled;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Scene::updateBVH()
+		///
+		/// \brief	Brings the bottom level hierarchies up to date with the geometries (build of the new
+		/// 		ones, refit of the transformed ones, see TriangleBVH::update), then rebuilds the top
+		/// 		level hierarchy over the bounding boxes of the geometries if one of them has changed.
+		/// 		The emissive triangles are collected again whenever a geometry or an instance has
+		/// 		changed, refitted or not (see Scene::updateLights). This method is called by
+		/// 		Scene::compute, its time is counted in the bvhBuild stage of the profiler.
+		/// 		
+		/// 		With the ray statistics, the number of rebuilt and refitted hierarchies and the SAH cost
+		/// 		of the scene are counted (see System::RayStatistics::countHierarchyUpdate): the cost of
+		/// 		each geometry hierarchy after its last build or refit, weighted by the probability that
+		/// 		a ray crossing the scene crosses the geometry (the top level hierarchy is not counted).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void updateBVH()
+		{
+			System::Profiler::Scope profile(System::Profiler::bvhBuild);
+
+			// Geometrie ou instance ajoutee, deplacee ou modifiee depuis la derniere mise a jour
+			bool changed = !m_topLevelUpToDate;
+			int nbRefitted = 0, nbRebuilt = 0;
+			BoundingBox sceneBox;
+			for(int i = 0; i < (int)m_geometries.size(); i++)
+			{
+				TriangleBVH::UpdateResult result = m_geometryBVHs[i].update(m_geometries[i].second, m_buildMode, m_maxRefitDegradation);
+				if(result != TriangleBVH::unchanged)
+				{
+					// La boite englobante de la geometrie a change
+					m_geometries[i].first.set(m_geometries[i].second);
+					changed = true;
+					(result == TriangleBVH::refitted ? nbRefitted : nbRebuilt)++;
+				}
+				sceneBox.update(m_geometries[i].first);
+			}
+			std::vector<bool> meshChanged(m_meshes.size(), false);
+			for(int i = 0; i < (int)m_meshes.size(); i++)
+			{
+				TriangleBVH::UpdateResult result = m_meshBVHs[i].update(m_meshes[i].second, m_buildMode, m_maxRefitDegradation);
+				if(result != TriangleBVH::unchanged)
+				{
+					m_meshes[i].first.set(m_meshes[i].second);
+					meshChanged[i] = true;
+					(result == TriangleBVH::refitted ? nbRefitted : nbRebuilt)++;
+				}
+			}
+			for(int i = 0; i < (int)m_instances.size(); i++)
+			{
+				// Les instances d'un maillage modifie sont deplacees
+				const Instance & instance = m_instances[i].second;
+				if(meshChanged[instance.mesh()])
+				{
+					m_instances[i].first = instance.boundingBox(m_meshes[instance.mesh()].first);
+					changed = true;
+				}
+				sceneBox.update(m_instances[i].first);
+			}
+
+			// Des triangles ont pu etre ajoutes avec de nouveaux materiaux
+			if(!m_materialsUpToDate || nbRebuilt > 0)
+				updateMaterials();
+
+			if(changed)
+			{
+				std::vector<BoundingBox, aligned_allocator<BoundingBox, 16> > boxes;
+				for(int i = 0; i < (int)m_geometries.size(); i++)
+				{
+					boxes.push_back(m_geometries[i].first);
+				}
+				for(int i = 0; i < (int)m_instances.size(); i++)
+				{
+					boxes.push_back(m_instances[i].first);
+				}
+				m_topLevelBVH.build(boxes);
+				m_topLevelUpToDate = true;
+
+				// Les sources lumineuses suivent les triangles deplaces
+				updateLights();
+			}
+
+			System::RayStatistics & statistics = System::RayStatistics::instance();
+			if(statistics.enabled())
+			{
+				float cost = 0.0f;
+				for(int i = 0; i < (int)m_geometries.size() && sceneBox.surface() > 0.0f; i++)
+				{
+					cost += m_geometryBVHs[i].sahCost() * m_geometries[i].first.surface() / sceneBox.surface();
+				}
+				for(int i = 0; i < (int)m_instances.size() && sceneBox.surface() > 0.0f; i++)
+				{
+					cost += m_meshBVHs[m_instances[i].second.mesh()].sahCost() * m_instances[i].first.surface() / sceneBox.surface();
+				}
+				statistics.countHierarchyUpdate(nbRebuilt, nbRefitted, cost);
+			}
 		}
 
 		////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -80,202 +781,529 @@ namespace Geometry
 		///
 		/// \brief	Adds a poitn light in the scene.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
-		/// \param [in,out]	light	If non-null, the light to add.
+		/// \param [in,out]	light	If non-null, the light to add.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void add(const PointLight & light)
+		{
+			m_lights.push_back(light);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Scene::updateMaterials()
+		///
+		/// \brief	Rebuilds the material table read by the shading: each distinct material of the
+		/// 		geometries, of the meshes and of the instances is copied once, and the triangles and the
+		/// 		instances store the index of their copy. Index 0 is a black material given to the
+		/// 		triangles without material. Called by Scene::updateBVH when geometries, meshes or
+		/// 		instances have been added or rebuilt, never during a rendering.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \exception	std::length_error	Thrown if the scene has more than 65535 materials.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void updateMaterials()
+		{
+			m_materials.clear();
+			m_materials.push_back(Material(RGBColor(), RGBColor(), RGBColor(), 1, RGBColor(), 0.0));
+			std::map<const Material *, unsigned short> ids;
+			ids[NULL] = 0;
+			std::vector<const Material *> materials;
+			for(int i = 0; i < (int)m_geometries.size() + (int)m_meshes.size(); i++)
+			{
+				const Geometry & geometry = i < (int)m_geometries.size() ? m_geometries[i].second : m_meshes[i - m_geometries.size()].second;
+				const std::deque<Triangle, aligned_allocator<Triangle, 16> > & triangles = geometry.getTriangles();
+				for(int j = 0; j < (int)triangles.size(); j++)
+					materials.push_back(triangles[j].material());
+			}
+			for(int i = 0; i < (int)m_instances.size(); i++)
+				materials.push_back(m_instances[i].second.material());
+			for(size_t i = 0; i < materials.size(); i++)
+			{
+				if(ids.find(materials[i]) != ids.end())
+					continue;
+				// Material::s_noMaterial n'est pas un indice valide
+				if(m_materials.size() >= Material::s_noMaterial)
+					throw std::length_error("Scene::updateMaterials() - More than 65535 materials.");
+				ids[materials[i]] = (unsigned short)m_materials.size();
+				m_materials.push_back(*materials[i]);
+			}
+			for(int i = 0; i < (int)m_geometries.size(); i++)
+				m_geometries[i].second.setMaterialIds(ids);
+			for(int i = 0; i < (int)m_meshes.size(); i++)
+				m_meshes[i].second.setMaterialIds(ids);
+			for(int i = 0; i < (int)m_instances.size(); i++)
+			{
+				Instance & instance = m_instances[i].second;
+				instance.setMaterialId(instance.material() != NULL ? ids[instance.material()] : Material::s_noMaterial);
+			}
+			m_materialsUpToDate = true;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Scene::updateLights()
+		///
+		/// \brief	Collects the triangles whose material has a non-zero emissive color (geometries and
+		/// 		instances) and builds the alias table used to sample them, each triangle being weighted
+		/// 		by its area times the luminance of its emissive color. Called by Scene::updateBVH when a
+		/// 		geometry or an instance has changed, so that the lights follow the refitted geometries.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void updateLights()
+		{
+			m_emissiveTriangles.clear();
+			std::vector<float> weights;
+			const Math::Transform identity;
+			for(int i = 0; i < (int)m_geometries.size(); i++)
+			{
+				const std::deque<Triangle, aligned_allocator<Triangle, 16> > & triangles = m_geometries[i].second.getTriangles();
+				for(int j = 0; j < (int)triangles.size(); j++)
+				{
+					float power = m_materials[triangles[j].materialId()].emissiveColor().luminance() * triangles[j].area();
+					if(power > 0.0f)
+					{
+						m_emissiveTriangles.push_back(triangles[j].transformed(identity, NULL, Material::s_noMaterial));
+						weights.push_back(power);
+					}
+				}
+			}
+			for(int i = 0; i < (int)m_instances.size(); i++)
+			{
+				const Instance & instance = m_instances[i].second;
+				const std::deque<Triangle, aligned_allocator<Triangle, 16> > & triangles = m_meshes[instance.mesh()].second.getTriangles();
+				for(int j = 0; j < (int)triangles.size(); j++)
+				{
+					const Material & material = m_materials[instance.material() != NULL ? instance.materialId() : triangles[j].materialId()];
+					if(material.emissiveColor().luminance() <= 0.0f)
+						continue;
+					Triangle triangle = triangles[j].transformed(instance.toWorld(), instance.material(), instance.materialId());
+					m_emissiveTriangles.push_back(triangle);
+					weights.push_back(material.emissiveColor().luminance() * triangle.area());
+				}
+			}
+			m_lightTable.build(weights);
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Scene::setCamera(Camera const & cam)
+		///
+		/// \brief	Sets the camera.
+		///
+		/// \author	F. Lamarche, Université de Rennes 1
+		/// \date	04/12/2013
+		///
+		/// \param	cam	The camera.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void setCamera(Camera const & cam)
+		{
+			m_camera = cam;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	int intersectBoundingBox(Ray const & ray)
+		///
+		/// \brief	Detecte l'intersection la plus proche entre les volumes englobants des geometries et le
+		/// 		rayon.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	06/11/2015
+		///
+		/// \param	ray			Le rayon.
+		///
+		/// \return	L'indice de la geometrie dont le volume englobant est atteint en premier par le rayon
+		/// 		(-1 si aucun).
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		int intersectBoundingBox(Ray const & ray)
+		{
+			int indiceG = -1;
+			float profondeurMin = std::numeric_limits<float>::max();
+
+			for(int i = 0; i < (int)m_geometries.size(); i++)
+			{
+				float profondeur;
+				if(m_geometries[i].first.intersect(ray, 0.0f, profondeurMin, profondeur) && profondeur < profondeurMin)
+				{
+					profondeurMin = profondeur;
+					indiceG = i;
+				}
+			} 
+
+			return indiceG;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	RayTriangleIntersection * intersectTriangle(Ray const & ray, System::RayStatistics::RayType type)
+		///
+		/// \brief	Detecte l'intersection entre le triangle d'une geometrie et le rayon.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	06/11/2015
+		///
+		/// \param	ray			Le rayon..
+		/// \param	type		Le type du rayon (voir System::RayStatistics et System::Profiler).
+		///
+		/// \return	Le RayTriangleIntersection representant l'intersction entre le rayon et le triangle le plus
+		/// 		proche (invalide si aucun triangle n'est intercepte).
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		RayTriangleIntersection intersectTriangle(Ray const & ray, System::RayStatistics::RayType type)
+		{
+			System::Profiler::Scope profile(type == System::RayStatistics::primaryRay ? System::Profiler::primaryRays : System::Profiler::indirectRays);
+			float profondeurMin = std::numeric_limits<float>::max();
+
+			//parcours des hierarchies de volumes englobants (geometries puis triangles)
+			ClosestTriangle closestTriangle;
+			traverse(ray, profondeurMin, closestTriangle);
+			System::RayStatistics::countRay(type, closestTriangle.nodes(), closestTriangle.triangles());
+
+			//aucun triangle intercepte
+			if(closestTriangle.triangle() == NULL)
+			{
+				return RayTriangleIntersection(&ray);
+			}
+
+			//triangle d'une instance : il reste dans le repere de son maillage (voir HitRecord)
+			if(closestTriangle.instance() != NULL)
+			{
+				return RayTriangleIntersection(closestTriangle.triangle(), closestTriangle.instance(), &ray, profondeurMin, closestTriangle.u(), closestTriangle.v());
+			}
+
+			return RayTriangleIntersection(closestTriangle.triangle(), &ray, profondeurMin, closestTriangle.u(), closestTriangle.v());
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	const Material & materialOf(RayTriangleIntersection const & intersection) const
+		///
+		/// \brief	Materiau d'une intersection valide, lu dans la table des materiaux (voir
+		/// 		Scene::updateMaterials). Le materiau d'une instance remplace celui de son maillage.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	intersection	L'intersection.
+		///
+		/// \return	Le materiau du triangle intercepte.
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		void add(const PointLight & light)
+		const Material & materialOf(RayTriangleIntersection const & intersection) const
 		{
-			m_lights.push_back(light);
+			const Instance * instance = intersection.instance();
+			return m_materials[instance != NULL && instance->material() != NULL ? instance->materialId() : intersection.triangle()->materialId()];
 		}
 
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		/// \fn	void Scene::setCamera(Camera const & cam)
+		/// \fn	bool occluded(Ray const & ray, float tMax)
 		///
-		/// \brief	Sets the camera.
+		/// \brief	Teste si un triangle quelconque est intercepte par le rayon avant la distance tMax. Le
+		/// 		parcours s'arrete au premier triangle trouve (rayons d'ombre).
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
-		/// \date	04/12/2013
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
 		///
-		/// \param	cam	The camera.
+		/// \param	ray			Le rayon.
+		/// \param	tMax		La distance maximale testee le long du rayon.
+		///
+		/// \return	true si un triangle est intercepte avant tMax.
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		void setCamera(Camera const & cam)
+		bool occluded(Ray const & ray, float tMax)
 		{
-			m_camera = cam;
+			System::Profiler::Scope profile(System::Profiler::shadowRays);
+			AnyTriangle anyTriangle;
+			bool result = traverse(ray, tMax, anyTriangle);
+			System::RayStatistics::countRay(System::RayStatistics::shadowRay, anyTriangle.nodes(), anyTriangle.triangles());
+			return result;
 		}
-
+	
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		/// \fn	int intersectBoundingBox(Ray const & ray, int depth, int maxDepth)
+		/// \fn	RGBColor sendRay(Ray const & ray, int depth, int maxDepth, int nbRandomRay, Math::Random & random, System::RayStatistics::RayType type)
 		///
-		/// \brief	Detecte une intersection entre le volume englobant et le rayon.
+		/// \brief	Sends a ray in the scene and returns the computed color
 		///
-		/// \author	L. Foucault & V. Goupoil, Universit de Rennes 1
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
 		/// \date	06/11/2015
 		///
 		/// \param	ray			Le rayon.
 		/// \param	depth   	La profondeur courrante.
 		/// \param	maxDepth	La profondeur maximum.
+		/// \param	nbRandomRay	Le nombre de rayons aleatoires lances a chaque rebond.
+		/// \param	random		Le generateur aleatoire de l'echantillon (voir Math::Random::forSample).
+		/// \param	type		Le type du rayon (voir System::RayStatistics).
 		///
-		/// \return	L'indice de la liste de geometrie ou on detecte une intersection. 
+		/// \return	La couleur du triangle intercepte par le rayon.
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		int intersectBoundingBox(Ray const & ray, int depth, int maxDepth)
+		RGBColor sendRay(Ray const & ray, int depth, int maxDepth, int nbRandomRay, Math::Random & random, System::RayStatistics::RayType type)
 		{
-			for(int i = 0; i < m_geometries.size(); i++)
-			{
-				if(m_geometries[i].first.intersect(ray, depth, maxDepth))
-				{
-					return i;
-				}
-			} 
-
-			return -1;
+			return sendRay(ray, intersectTriangle(ray, type), depth, maxDepth, nbRandomRay, random);
 		}
 
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		/// \fn	RayTriangleIntersection * intersectTriangle(Ray const & ray)
+		/// \fn	RGBColor sendRay(Ray const & ray, RayTriangleIntersection const & rayTriangle, int depth, int maxDepth, int nbRandomRay, Math::Random & random)
 		///
-		/// \brief	Detecte l'intersection entre le triangle d'une geometrie et le rayon.
+		/// \brief	Calcule la couleur d'un rayon deja intersecte avec la scene (voir Scene::intersectTriangle),
+		/// 		pour que l'appelant puisse utiliser l'intersection sans relancer le rayon.
 		///
-		/// \author	L. Foucault & V. Goupoil, Universit de Rennes 1
-		/// \date	06/11/2015
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
 		///
-		/// \param	ray			Le rayon..
+		/// \param	ray			Le rayon.
+		/// \param	rayTriangle	L'intersection du rayon avec la scene (invalide si le rayon sort de la scene).
+		/// \param	depth   	La profondeur courrante.
+		/// \param	maxDepth	La profondeur maximum.
+		/// \param	nbRandomRay	Le nombre de rayons aleatoires lances a chaque rebond.
+		/// \param	random		Le generateur aleatoire de l'echantillon (voir Math::Random::forSample).
 		///
-		/// \return	Le RayTriangleIntersection representant l'intersction entre le rayon et le triangle.
+		/// \return	La couleur du triangle intercepte par le rayon.
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		RayTriangleIntersection intersectTriangle(Ray const & ray)
+		RGBColor sendRay(Ray const & ray, RayTriangleIntersection const & rayTriangle, int depth, int maxDepth, int nbRandomRay, Math::Random & random)
 		{
-			int indiceG = 0, indiceT = 0; //indice de la geometrie , du triangle
-			float profondeurMin = std::numeric_limits<float>::max();
+			RGBColor result(0, 0, 0);
 
-			CastedRay castedRay(ray.source(), ray.direction());
+			// Le chemin se termine quand le rayon sort de la scene ou a la profondeur maximum
+			if(!rayTriangle.valid() || depth >= maxDepth)
+				System::RayStatistics::countPath(depth + 1);
 
-			//parcours de toutes les geometries
-			for(int i=0; i<m_geometries.size(); i++)
-			{
-				const std::deque<Triangle, aligned_allocator<Triangle, 16> > & listTriangle = m_geometries[i].second.getTriangles();
-				
-				//parcours de tous les triangles de la geometrie courante
-				for(int j=0; j< listTriangle.size(); j++)
-				{	
-					float profondeur,u,v;
+			if(!rayTriangle.valid())
+				return result;
 
-					//si l'intersection entre le rayon et le triangle actuel est valide
-					if(((m_geometries[i].second).getTriangles()[j]).intersection(ray, profondeur, u, v))
-					{
-						//si la distance entre la source du rayon et le point d'intercection
-						//est inferieur  profondeurMin
-						if (profondeur < profondeurMin)
-						{	
-							//alors on met a jour la profondeur et les indices
-							profondeurMin = profondeur;
-							indiceG = i;
-							indiceT = j;
-						}
-					}
-				}
-			}
+			// Materiau lu dans la table des materiaux (voir Scene::updateMaterials)
+			const Material & material = materialOf(rayTriangle);
+
+			// Emission du triangle (noire si le materiau n'est pas emissif)
+			result = material.emissiveColor();
+
+			// A la profondeur maximum, seule l'emission du triangle est collectee
+			const int lobes = material.lobes() & (Material::diffuseLobe | Material::specularLobe);
+			if(depth >= maxDepth || lobes == 0)
+				return result;
+
+			// Donnees d'ombrage calculees une seule fois pour ce point
+			const HitRecord hit(ray, rayTriangle, material);
 
-			return RayTriangleIntersection(&((this->m_geometries[indiceG].second).getTriangles()[indiceT]), &ray);
+			//return result + getDiffuseIntensity(ray, hit, depth, maxDepth, random);
+			//return result + getSpecularIntensity(ray, hit, depth, maxDepth, random);
+			//return result + getDiffuseIntensity(ray, hit, depth, maxDepth, random) + getSpecularIntensity(ray, hit, depth, maxDepth, random);
+			switch(lobes)
+			{
+			case Material::diffuseLobe:
+				return result + getIlluminationGlobaleDiffuseIntensity(hit, depth, maxDepth, nbRandomRay, random);
+			case Material::specularLobe:
+				return result + getIlluminationGlobaleSpecularIntensity(ray, hit, depth, maxDepth, nbRandomRay, random);
+			default:
+				return result + getIlluminationGlobaleDiffuseIntensity(hit, depth, maxDepth, nbRandomRay, random) + getIlluminationGlobaleSpecularIntensity(ray, hit, depth, maxDepth, nbRandomRay, random);
+			}
 		}
-	
+		
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		/// \fn	RGBColor sendRay(Ray const & ray, int depth, int maxDepth)
+		/// \fn	RGBColor evaluateBrdf(Material const * material, Math::Vector3 const & normal, Math::Vector3 const & reflected, float diffuseProbability, Math::Vector3 const & direction, float & pdf)
 		///
-		/// \brief	Sends a ray in the scene and returns the computed color
+		/// \brief	Evalue la BRDF (diffus + Phong normalise) multipliee par le cosinus pour une direction
+		/// 		sortante, ainsi que la densite avec laquelle tracePath echantillonne cette direction.
 		///
-		/// \author	L. Foucault & V. Goupoil, Universit de Rennes 1
-		/// \date	06/11/2015
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
 		///
-		/// \param	ray			Le rayon.
-		/// \param	depth   	La profondeur courrante.
-		/// \param	maxDepth	La profondeur maximum.
+		/// \param	material			Le materiau.
+		/// \param	normal				La normale orientee du cote du rayon incident.
+		/// \param	reflected			La direction reflechie du rayon incident.
+		/// \param	diffuseProbability	La probabilite de choisir la composante diffuse.
+		/// \param	direction			La direction sortante.
+		/// \param [out]	pdf			La densite (angle solide) de la direction.
 		///
-		/// \return	La couleur du triangle intercepte par le rayon.
+		/// \return	La BRDF multipliee par le cosinus (noir sous la surface).
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		RGBColor sendRay(Ray const & ray, int depth, int maxDepth, int nbRandomRay)
+		static RGBColor evaluateBrdf(Material const * material, Math::Vector3 const & normal, Math::Vector3 const & reflected, float diffuseProbability, Math::Vector3 const & direction, float & pdf)
 		{
-			RGBColor result(0, 0, 0);
-
-			const RayTriangleIntersection rayTriangle = intersectTriangle(ray);
-
-			if(rayTriangle.triangle()->material()->emissiveColor() != (0, 0, 0))
-				result = rayTriangle.triangle()->material()->emissiveColor();
-			
-			if(depth < maxDepth)
+			float cos = direction * normal;
+			if(cos <= 0.0f)
 			{
-				//return result + getDiffuseIntensity(ray, rayTriangle, depth, maxDepth);														
-				//return result + getSpecularIntensity(ray, rayTriangle, depth, maxDepth);
-				//return result + getDiffuseIntensity(ray, rayTriangle, depth, maxDepth) + getSpecularIntensity(ray, rayTriangle, depth, maxDepth);
-				return result + getIlluminationGlobaleDiffuseIntensity(ray, rayTriangle, depth, maxDepth, nbRandomRay) + getIlluminationGlobaleSpecularIntensity(ray, rayTriangle, depth, maxDepth, nbRandomRay);
+				pdf = 0.0f;
+				return RGBColor(0, 0, 0);
 			}
-			else
+			const float E = material->specularExponent();
+			float cosReflected = direction * reflected;
+			float lobe = (cosReflected > 0.0f) ? powf(cosReflected, E) : 0.0f;
+			pdf = diffuseProbability * cos / (float)M_PI + (1.0f - diffuseProbability) * (E + 1.0f) / (2.0f * (float)M_PI) * lobe;
+			return (material->diffuseColor() * (1.0f / (float)M_PI) + material->specularColor() * ((E + 2.0f) / (2.0f * (float)M_PI) * lobe)) * cos;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	RGBColor tracePath(Ray const & ray, int maxDepth, Math::Sampler & sampler)
+		///
+		/// \brief	Trace un chemin a partir du rayon et retourne la luminance collectee (integrateur
+		/// 		pathTracingIntegrator). A chaque rebond, un point est echantillonne sur les triangles
+		/// 		emissifs (voir Scene::updateLights) et teste par un rayon d'ombre, puis un seul rayon
+		/// 		est lance : la composante diffuse ou speculaire est choisie aleatoirement selon leur
+		/// 		luminance, puis une direction est echantillonnee selon le cosinus (diffus) ou le lobe
+		/// 		cos^n (Phong normalise). Les deux strategies sont combinees par echantillonnage
+		/// 		preferentiel multiple (heuristique des puissances). Apres s_russianRouletteDepth
+		/// 		rebonds, le chemin est interrompu par roulette russe. Le cout est lineaire en la
+		/// 		profondeur.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	ray			Le rayon primaire.
+		/// \param	maxDepth	Le nombre maximum de rebonds.
+		/// \param	sampler		L'echantillonneur, place sur l'echantillon du pixel (voir Math::Sampler).
+		///
+		/// \return	La luminance du chemin.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		RGBColor tracePath(Ray const & ray, int maxDepth, Math::Sampler & sampler)
+		{
+			RGBColor radiance(0, 0, 0);
+			RGBColor throughput(1, 1, 1);				// Produit des BRDF * cosinus / densites le long du chemin
+			Ray currentRay = ray;
+			float brdfPdf = 0.0f;						// Densite de la direction du rayon courant (0 : rayon primaire)
+
+			System::RayStatistics::RayType type = System::RayStatistics::primaryRay;
+			int depth;
+			for(depth = 0; ; depth++)
 			{
-				return result;
+				const RayTriangleIntersection rayTriangle = intersectTriangle(currentRay, type);
+				if(!rayTriangle.valid())
+					break;
+
+				const Material * material = &materialOf(rayTriangle);
+
+				// Position, normale orientee du cote du rayon incident et direction reflechie
+				const HitRecord hit(currentRay, rayTriangle, *material);
+				const Math::Vector3 & normal = hit.normal();
+				const Math::Vector3 & reflected = hit.reflected();
+				const Math::Vector3 & position = hit.position();
+
+				RGBColor emissive = material->emissiveColor();
+				float emissiveLuminance = emissive.luminance();
+				if(emissiveLuminance > 0.0f)
+				{
+					// Le rayon d'ombre du rebond precedent pouvait aussi atteindre ce point
+					float weight = 1.0f;
+					float cosLight = fabsf(normal * currentRay.direction());
+					if(brdfPdf > 0.0f && cosLight > 0.0f && !m_lightTable.empty())
+					{
+						float distance = rayTriangle.tRayValue();
+						float lightPdf = emissiveLuminance / m_lightTable.total() * distance * distance / cosLight;
+						weight = brdfPdf * brdfPdf / (brdfPdf * brdfPdf + lightPdf * lightPdf);
+					}
+					radiance = radiance + throughput * emissive * weight;
+				}
+				if(depth >= maxDepth)
+					break;
+
+				// Choix de la composante selon sa luminance
+				float diffuseWeight = material->diffuseColor().luminance();
+				float specularWeight = material->specularColor().luminance();
+				if(diffuseWeight + specularWeight <= 0.0f)
+					break;
+				float diffuseProbability = diffuseWeight / (diffuseWeight + specularWeight);
+
+				// Echantillonnage d'un point sur une source lumineuse
+				if(!m_lightTable.empty())
+				{
+					float u1, u2;
+					sampler.get2D(u1, u2);
+					const Triangle & light = m_emissiveTriangles[m_lightTable.sample(u1, u2)];
+					sampler.get2D(u1, u2);
+					Math::Vector3 toLight = light.samplePoint(u1, u2) - position;
+					float distance = toLight.norm();
+					Math::Vector3 direction = toLight * (1.0f / distance);
+					float cosLight = fabsf(light.normal() * direction);
+					float pdf;
+					RGBColor brdf = evaluateBrdf(material, normal, reflected, diffuseProbability, direction, pdf);
+					if(pdf > 0.0f && cosLight > 0.0f && !occluded(Ray(position, direction), distance * 0.999f))
+					{
+						RGBColor lightEmissive = m_materials[light.materialId()].emissiveColor();
+						float lightPdf = lightEmissive.luminance() / m_lightTable.total() * distance * distance / cosLight;
+						float weight = lightPdf * lightPdf / (lightPdf * lightPdf + pdf * pdf);
+						radiance = radiance + throughput * brdf * lightEmissive * (weight / lightPdf);
+					}
+				}
+
+				// Echantillonnage de la BRDF
+				Math::Vector3 direction;
+				float lobe = sampler.get1D();
+				float u1, u2;
+				sampler.get2D(u1, u2);
+				type = lobe < diffuseProbability ? System::RayStatistics::diffuseRay : System::RayStatistics::specularRay;
+				if(lobe < diffuseProbability)
+					direction = hit.diffuseDirection().generate(u1, u2);
+				else
+					direction = Math::RandomDirection(reflected, material->specularExponent()).generate(u1, u2);
+				RGBColor brdf = evaluateBrdf(material, normal, reflected, diffuseProbability, direction, brdfPdf);
+				if(brdfPdf <= 0.0f)
+					break;
+				throughput = throughput * brdf / brdfPdf;
+
+				// Roulette russe
+				if(depth + 1 >= s_russianRouletteDepth)
+				{
+					float survival = ::std::min(throughput.maxComponent(), 0.95f);
+					if(sampler.get1D() >= survival)
+						break;
+					throughput = throughput / survival;
+				}
+
+				currentRay = Ray(position, direction);
 			}
+			// Un rayon est lance a chaque iteration
+			System::RayStatistics::countPath(depth + 1);
+
+			return radiance;
 		}
-		
+
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		/// \fn	RGBColor getDiffuseIntensity(Ray const & ray, RayTriangleIntersection const & rayTriangle, int & depth, int & maxDepth)
+		/// \fn	RGBColor getDiffuseIntensity(Ray const & ray, HitRecord const & hit, int & depth, int & maxDepth, Math::Random & random)
 		///
 		/// \brief	
 		/// 		
-		/// \author	L. Foucault & V. Goupoil, Universit de Rennes 1
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
 		/// \date	13/11/2015
 		///
 		/// \param	ray						Le rayon.
-		/// \param	rayTriangle				intersction entre le rayon et le triangle.
+		/// \param	hit						donnees d'ombrage de l'intersection entre le rayon et le triangle.
 		///	\param	depth					profondeur conrante du rebond.
 		///	\param	maxDepth				profondeur maximale des rebonds.
+		///	\param	random					generateur aleatoire de l'echantillon.
 		///
 		/// \return	La composante diffuse du point d'intersection.
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		RGBColor getDiffuseIntensity(Ray const & ray, RayTriangleIntersection const & rayTriangle, int & depth, int & maxDepth)
+		RGBColor getDiffuseIntensity(Ray const & ray, HitRecord const & hit, int & depth, int & maxDepth, Math::Random & random)
 		{
 			RGBColor diffuseColor(0, 0, 0);
 			RGBColor shadow(0, 0,0);
 			
-			const Triangle *triangle = rayTriangle.triangle();
-			float profondeur = rayTriangle.tRayValue();
-
-			RGBColor couleurTriangle = triangle->material()->diffuseColor();
+			RGBColor couleurTriangle = hit.material()->diffuseColor();
 			
-			if(couleurTriangle != 0)
+			if(hit.has(Material::diffuseLobe))
 			{
+				// Point d'intersection entre le triangle et la source
+				const Math::Vector3 & positionP = hit.position();
+
 				for(int i = 0; i < m_lights.size(); i++)
 				{
-					// Calcul du point d'intersection entre le triangle et la source
-					Math::Vector3 positionP = ray.source() + ray.direction() * profondeur;
-
-					// Calcul de l'intensit de la source
+					// Calcul de l'intensité de la source
 					RGBColor Isource = m_lights[i].color();
 
-					// Calcul du rayon L = lumire - point d'intersection / || lumire - point d'intersection ||
-					Math::Vector3 rayonIncident = (m_lights[i].position() - positionP) / (m_lights[i].position() - positionP).norm();
+					// Calcul de la distance entre la source et le point d'intersection
+					Math::Vector3 versSource = m_lights[i].position() - positionP;
+					float dsource = versSource.norm();
 
-					float cos = triangle->normal() * rayonIncident;		// Calcul des cosinus entre la normal et le rayon L
+					// Calcul du rayon L = lumière - point d'intersection / || lumière - point d'intersection ||
+					Math::Vector3 rayonIncident = versSource / dsource;
 
-					if (rayonIncident * triangle->normal() < 0)			// Retourne la direction de la normal au plan si elle est du mauvais ct
-						cos = cos * (-1);								// Inversion du cosinus	
+					// Cosinus entre la normale orientee du cote du rayon et le rayon L
+					float cos = fabsf(hit.normal() * rayonIncident);
 
-					// Calcul de la distance entre la source et le point d'intersection
-					float dsource = (m_lights[i].position() - positionP).norm();
-
-					// Ajout des ombres
-					Ray shadowRay(m_lights[i].position(), rayonIncident*(-1));
-					const RayTriangleIntersection rayTriangleShadow = intersectTriangle(shadowRay);
-					
-					// Calcul de l'indice de refraction du materiau touch par le rayon
-					float indiceRefraction = triangle->material()->indiceRefraction();
-					
-					if(indiceRefraction != 0.0f)
+					if(hit.has(Material::refractiveLobe))
 					{
-						Math::Vector3 dirRefraction = triangle->refractionDirection(ray);
-						diffuseColor = diffuseColor + getRefractionId(indiceRefraction, positionP, dirRefraction, depth, maxDepth);
+						Math::Vector3 dirRefraction = hit.refractionDirection(ray);
+						diffuseColor = diffuseColor + getRefractionId(hit.material()->indiceRefraction(), positionP, dirRefraction, depth, maxDepth, random);
 					}
-					// Si on traverse le mme triangle que prcedemment -> On retourne l'ombre
-					else if (rayTriangleShadow.triangle() != triangle)
+					// Ajout des ombres : un triangle entre la source et le point d'intersection -> On retourne l'ombre
+					// (la marge evite que le triangle eclaire ne s'occulte lui-meme)
+					else if (occluded(Ray(m_lights[i].position(), rayonIncident*(-1)), dsource*0.999f))
 					{
 						diffuseColor = diffuseColor + shadow;
 					}
@@ -291,75 +1319,70 @@ namespace Geometry
 		}
 		
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		/// \fn	RGBColor getSpecularIntensity(Ray const & ray,RayTriangleIntersection const & rayTriangle, int & depth, int & maxDepth)
+		/// \fn	RGBColor getSpecularIntensity(Ray const & ray, HitRecord const & hit, int & depth, int & maxDepth, Math::Random & random)
 		///
 		/// \brief	
 		/// 		
-		/// \author	L. Foucault & V. Goupoil, Universit de Rennes 1
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
 		/// \date	24/11/2015
 		///
 		/// \param	ray						Le rayon.
-		/// \param	rayTriangle				intersction entre le rayon et le triangle.
+		/// \param	hit						donnees d'ombrage de l'intersection entre le rayon et le triangle.
 		///	\param	depth					profondeur conrante du rebond
 		///	\param	maxDepth				profondeur maximale des rebonds
+		///	\param	random					generateur aleatoire de l'echantillon.
 		///
 		/// \return	La composante speculaire du point d'intersection.
 		////////////////////////////////////////////////////////////////////////////////////////////////////		
-		RGBColor getSpecularIntensity(Ray const & ray, RayTriangleIntersection const & rayTriangle, int & depth, int & maxDepth)
+		RGBColor getSpecularIntensity(Ray const & ray, HitRecord const & hit, int & depth, int & maxDepth, Math::Random & random)
 		{
 			RGBColor speculaireColor(0, 0, 0);
 			RGBColor shadow = 0;
 			
-			const Triangle *triangle = rayTriangle.triangle();
-			float profondeur = rayTriangle.tRayValue();
-			int E = triangle->material()->specularExponent();
+			int E = hit.material()->specularExponent();
 
-			RGBColor couleurTriangle = triangle->material()->specularColor();
+			RGBColor couleurTriangle = hit.material()->specularColor();
 
-			if (couleurTriangle != 0)
+			if (hit.has(Material::specularLobe))
 			{
+				// Point d'intersection entre le triangle et la source
+				const Math::Vector3 & positionP = hit.position();
+
+				// Rayon de la composante speculaire parfaite de la surface
+				const Ray rayIdealSpeculaire(positionP, hit.reflected());
+
 				for (int i = 0; i < m_lights.size(); i++)
 				{
-					// Calcul du point d'intersection entre le triangle et la source
-					Math::Vector3 positionP = ray.source() + ray.direction() * profondeur;
-
-					// Calcul de l'intensit de la source
+					// Calcul de l'intensité de la source
 					RGBColor Isource = m_lights[i].color();
 
-					// Calcul du rayon L = lumire - point d'intersection / || lumire - point d'intersection ||
-					Math::Vector3 rayonIncident = (m_lights[i].position() - positionP) / (m_lights[i].position() - positionP).norm();
-
-					float cos = (ray.direction()*(-1)) * (triangle->reflectionDirection(rayonIncident));		// Calcul des cosinus entre la normal et le rayon L
+					// Calcul de la distance entre la source et le point d'intersection
+					Math::Vector3 versSource = m_lights[i].position() - positionP;
+					float dsource = versSource.norm();
 
-					if (rayonIncident * triangle->normal() < 0)			// Retourne la direction de la normal au plan si elle est du mauvais ct
-						cos = cos * -1;									// Inversion du cosinus
+					// Calcul du rayon L = lumière - point d'intersection / || lumière - point d'intersection ||
+					Math::Vector3 rayonIncident = versSource / dsource;
 
-					// Calcul de la distance entre la source et le point d'intersection
-					float dsource = (m_lights[i].position() - positionP).norm();
+					float cos = (ray.direction()*(-1)) * (hit.reflectionDirection(rayonIncident));		// Calcul des cosinus entre la normal et le rayon L
 
-					// Ajout des ombres
-					Ray shadowRay(m_lights[i].position(), rayonIncident*(-1));
-					const RayTriangleIntersection  rayTriangleShadow = intersectTriangle(shadowRay);
+					if (rayonIncident * hit.geometricNormal() < 0)			// Retourne la direction de la normal au plan si elle est du mauvais côté
+						cos = cos * -1;									// Inversion du cosinus
 
-					// Calcul de l'indice de refraction du materiau touch par le rayon
-					float indiceRefraction = triangle->material()->indiceRefraction();
-					
-					if(indiceRefraction != 0.0f)
+					if(hit.has(Material::refractiveLobe))
 					{
-						Math::Vector3 dirRefraction = triangle->refractionDirection(ray);
-						speculaireColor = speculaireColor + getRefractionId(indiceRefraction, positionP, dirRefraction, depth, maxDepth);
+						Math::Vector3 dirRefraction = hit.refractionDirection(ray);
+						speculaireColor = speculaireColor + getRefractionId(hit.material()->indiceRefraction(), positionP, dirRefraction, depth, maxDepth, random);
 					}
-					// Si on traverse le mme triangle que prcedemment -> On retourne l'ombre
-					else if (rayTriangleShadow.triangle() != triangle)
+					// Ajout des ombres : un triangle entre la source et le point d'intersection -> On retourne l'ombre
+					// (la marge evite que le triangle eclaire ne s'occulte lui-meme)
+					else if (occluded(Ray(m_lights[i].position(), rayonIncident*(-1)), dsource*0.999f))
 					{
 						speculaireColor = speculaireColor + shadow;
 					}
 					else
 					{
-						// Calcul la composante speculaire parfaite de la surface	
-						Ray rayIdealSpeculaire((rayTriangle.intersection()), (rayTriangle.triangle()->reflectionDirection(rayTriangle.ray()->direction())));
 						// Calcul de la composante speculaire global : somme de toutes les composantes speculaire des sources lumineuses
-						speculaireColor = speculaireColor + (Isource * couleurTriangle * (pow(cos, E)) / dsource) + sendRay(rayIdealSpeculaire, depth + 1, maxDepth, 0);
+						speculaireColor = speculaireColor + (Isource * couleurTriangle * (pow(cos, E)) / dsource) + sendRay(rayIdealSpeculaire, depth + 1, maxDepth, 0, random, System::RayStatistics::specularRay);
 					}
 				}
 			}
@@ -368,63 +1391,55 @@ namespace Geometry
 		}
 		
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		/// \fn	RGBColor getIlluminationGlobaleDiffuseIntensity(Ray const & ray, RayTriangleIntersection const & rayTriangle, int depth, int maxDepth, int nbRandomRay)
+		/// \fn	RGBColor getIlluminationGlobaleDiffuseIntensity(HitRecord const & hit, int depth, int maxDepth, int nbRandomRay, Math::Random & random)
 		///
 		/// \brief	
 		/// 		
-		/// \author	L. Foucault & V. Goupoil, Universit de Rennes 1
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
 		/// \date	08/01/2016
 		///
-		/// \param	ray						Le rayon.
-		/// \param	rayTriangle				intersection entre le rayon et le triangle.
+		/// \param	hit						donnees d'ombrage de l'intersection entre le rayon et le triangle.
 		///	\param	depth					profondeur conrante du rebond.
 		///	\param	maxDepth				profondeur maximale des rebonds.
-		///	\param	nbRandomRay				nombre de rayon alatoire  lancer.
+		///	\param	nbRandomRay				nombre de rayon aléatoire à lancer.
+		///	\param	random					generateur aleatoire de l'echantillon.
 		///
 		/// \return	La composante speculaire ideal du point d'intersection.
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		RGBColor getIlluminationGlobaleDiffuseIntensity(Ray const & ray, RayTriangleIntersection const & rayTriangle, int depth, int maxDepth, int nbRandomRay)
+		RGBColor getIlluminationGlobaleDiffuseIntensity(HitRecord const & hit, int depth, int maxDepth, int nbRandomRay, Math::Random & random)
 		{
-			RGBColor emissiveDiffus(0, 0, 0);				// Dfinition de la composante speculaire  retourner 
-			RGBColor shadow(0, 0, 0);						// Dfinition de la composante d'ombre
+			RGBColor emissiveDiffus(0, 0, 0);				// Définition de la composante speculaire à retourner 
+			RGBColor shadow(0, 0, 0);						// Définition de la composante d'ombre
 			
-			const Triangle *triangle = rayTriangle.triangle();			// Triangle intersect par le rayon 
-			float profondeur = rayTriangle.tRayValue();					// Profondeur entre la source et le point d'intersection
-
-			Math::Vector3 positionP = ray.source() + ray.direction() * profondeur;		// Calcul du point d'intersection entre le triangle et la source
+			const Math::Vector3 & positionP = hit.position();		// Point d'intersection entre le triangle et la source
 
-			RGBColor couleurTriangle = triangle->material()->diffuseColor();	// Composante diffuse du materiau touch par le rayon 
+			RGBColor couleurTriangle = hit.material()->diffuseColor();	// Composante diffuse du materiau touché par le rayon 
 
-			if (couleurTriangle != 0)									// Si la composante diffuse du triangle touch n'est pas nulle on procde au calcul
+			if (hit.has(Material::diffuseLobe))						// Si la composante diffuse du triangle touché n'est pas nulle on procède au calcul
 			{
-				Math::Vector3 normal = triangle->normal();				// 
-
-				if (triangle->reflectionDirection(ray) * normal < 0)	// 
-					normal = -normal;									// 
-
-				Math::RandomDirection randomRay(normal);				// Cration d'une direction alatoire 
+				Math::RandomDirection randomRay = hit.diffuseDirection();	// Création d'une direction aléatoire autour de la normale orientee
 
-				for (int i = 0; i < nbRandomRay; i++)					// Pour chaque rayon alatoire lanc
+				for (int i = 0; i < nbRandomRay; i++)					// Pour chaque rayon aléatoire lancé
 				{
-					Ray reflectedRay(positionP, randomRay.generate());		// Cration du rayon  direction alatoire en question
+					Ray reflectedRay(positionP, randomRay.generate(random));		// Création du rayon à direction aléatoire en question
 
-					const RayTriangleIntersection rayTriangleEmissive = intersectTriangle(reflectedRay);	// Obtention de l'intersection entre le rayon alatoire et un triangle
-					const Triangle *triangleEmissive = rayTriangleEmissive.triangle();						// Obtention du triangle touch par le rayon alatoire
+					const RayTriangleIntersection rayTriangleEmissive = intersectTriangle(reflectedRay, System::RayStatistics::diffuseRay);	// Obtention de l'intersection entre le rayon aléatoire et un triangle
 
-					RGBColor Isource = emissiveDiffus + sendRay(reflectedRay, depth + 1, maxDepth, nbRandomRay);		// Envoie du rayon alatoire dans la scne et rcupration de la couleur du triangle
+					RGBColor Isource = emissiveDiffus + sendRay(reflectedRay, rayTriangleEmissive, depth + 1, maxDepth, nbRandomRay, random);		// Couleur du triangle touché par le rayon aléatoire (le rayon n'est pas relancé)
+
+					if (!rayTriangleEmissive.valid())						// Le rayon aléatoire sort de la scène
+						continue;
 
 					float profondeurEmissive = rayTriangleEmissive.tRayValue();								// Profondeur entre le point d'intersection et le triangle (source lumineuse)
 
 					Math::Vector3 positionPEmissive = reflectedRay.source() + reflectedRay.direction() * profondeurEmissive;		// Calcul du point d'intersection entre le point d'intersection et le triangle (source lumineuse)
 
-					Math::Vector3 rayonIncident = (positionPEmissive - positionP) / (positionPEmissive - positionP).norm();			// Calcul du rayon L = lumire - point d'intersection / || lumire - point d'intersection ||
-
-					float cos = triangle->normal() * rayonIncident;		// Calcul des cosinus entre la normal et le rayon L
+					Math::Vector3 versSource = positionPEmissive - positionP;							// Vecteur entre le point d'intersection et la source lumineuse
+					float dsource = versSource.norm();													// Calcul de la distance entre la source et le point d'intersection
+					Math::Vector3 rayonIncident = versSource / dsource;									// Calcul du rayon L = lumière - point d'intersection / || lumière - point d'intersection ||
 
-					if (rayonIncident * triangle->normal() < 0)			// Retourne la direction de la normal au plan si elle est du mauvais ct
-						cos = cos * (-1);								// Inversion du cosinus		
+					float cos = fabsf(hit.normal() * rayonIncident);									// Cosinus entre la normale orientee et le rayon L
 
-					float dsource = (positionPEmissive - positionP).norm();								// Calcul de la distance entre la source et le point d'intersection
 					RGBColor Id_source = ((Isource * couleurTriangle * cos) / dsource) / nbRandomRay;	// Calcul des composantes diffuses de la source lumineuse
 						
 					emissiveDiffus = emissiveDiffus + Id_source;										// Calcul de la composante diffuse global : somme de toutes les composantes diffuses des sources lumineuses
@@ -436,58 +1451,61 @@ namespace Geometry
 		}
 
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		/// \fn	RGBColor getIlluminationGlobaleSpecularIntensity(Ray const & ray, RayTriangleIntersection const & rayTriangle, int depth, int maxDepth, int nbRandomRay)
+		/// \fn	RGBColor getIlluminationGlobaleSpecularIntensity(Ray const & ray, HitRecord const & hit, int depth, int maxDepth, int nbRandomRay, Math::Random & random)
 		///
 		/// \brief	
 		/// 		
-		/// \author	L. Foucault & V. Goupoil, Universit de Rennes 1
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
 		/// \date	08/01/2016
 		///
 		/// \param	ray						Le rayon.
-		/// \param	rayTriangle				intersection entre le rayon et le triangle.
+		/// \param	hit						donnees d'ombrage de l'intersection entre le rayon et le triangle.
 		///	\param	depth					profondeur conrante du rebond.
 		///	\param	maxDepth				profondeur maximale des rebonds.
-		///	\param	nbRandomRay				nombre de rayon alatoire  lancer.
+		///	\param	nbRandomRay				nombre de rayon aléatoire à lancer.
+		///	\param	random					generateur aleatoire de l'echantillon.
 		///
 		/// \return	La composante speculaire ideal du point d'intersection.
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		RGBColor getIlluminationGlobaleSpecularIntensity(Ray const & ray, RayTriangleIntersection const & rayTriangle, int depth, int maxDepth, int nbRandomRay)
+		RGBColor getIlluminationGlobaleSpecularIntensity(Ray const & ray, HitRecord const & hit, int depth, int maxDepth, int nbRandomRay, Math::Random & random)
 		{
-			RGBColor emissiveSpeculare(0, 0, 0);			// Dfinition de la composante speculaire  retourner 
-			RGBColor shadow(0, 0, 0);						// Dfinition de la composante d'ombre
+			RGBColor emissiveSpeculare(0, 0, 0);			// Définition de la composante speculaire à retourner 
+			RGBColor shadow(0, 0, 0);						// Définition de la composante d'ombre
 			
-			const Triangle *triangle = rayTriangle.triangle();			// Triangle intersect par le rayon 
-			float profondeur = rayTriangle.tRayValue();					// Profondeur entre la source et le point d'intersection
-			const float E = triangle->material()->specularExponent();	// Exposant caractrisant la composante speculaire
+			const float E = hit.material()->specularExponent();		// Exposant caractérisant la composante speculaire
 
-			RGBColor couleurTriangle = triangle->material()->specularColor();	// Composante speculaire du materiau touch par le rayon 
+			RGBColor couleurTriangle = hit.material()->specularColor();	// Composante speculaire du materiau touché par le rayon 
 
-			if (couleurTriangle != 0)									// Si la composante speculaire du triangle touch n'est pas nulle on procde au calcul
+			if (hit.has(Material::specularLobe))						// Si la composante speculaire du triangle touché n'est pas nulle on procède au calcul
 			{
-				Math::RandomDirection randomRay(triangle->reflectionDirection(ray), E);		// Cration d'une direction alatoire 
+				const Math::Vector3 & positionP = hit.position();			// Point d'intersection entre le triangle et la source
 
-				for (int i = 0; i < nbRandomRay; i++)					// Pour chaque rayon alatoire lanc
+				Math::RandomDirection randomRay(hit.reflected(), E);		// Création d'une direction aléatoire autour de la direction reflechie
+
+				for (int i = 0; i < nbRandomRay; i++)					// Pour chaque rayon aléatoire lancé
 				{
-					Math::Vector3 positionP = ray.source() + ray.direction() * profondeur;		// Calcul du point d'intersection entre le triangle et la source
-					Ray reflectedRay(positionP, randomRay.generate());							// Cration du rayon  direction alatoire en question
+					Ray reflectedRay(positionP, randomRay.generate(random));							// Création du rayon à direction aléatoire en question
+
+					const RayTriangleIntersection rayTriangleEmissive = intersectTriangle(reflectedRay, System::RayStatistics::specularRay);	// Obtention de l'intersection entre le rayon aléatoire et un triangle
 
-					const RayTriangleIntersection rayTriangleEmissive = intersectTriangle(reflectedRay);	// Obtention de l'intersection entre le rayon alatoire et un triangle
-					const Triangle *triangleEmissive = rayTriangleEmissive.triangle();						// Obtention du triangle touch par le rayon alatoire
+					RGBColor Isource = emissiveSpeculare + sendRay(reflectedRay, rayTriangleEmissive, depth + 1, maxDepth, nbRandomRay, random);		// Couleur du triangle touché par le rayon aléatoire (le rayon n'est pas relancé)
 
-					RGBColor Isource = emissiveSpeculare + sendRay(reflectedRay, depth + 1, maxDepth, nbRandomRay);		// Envoie du rayon alatoire dans la scne et rcupration de la couleur du triangle
+					if (!rayTriangleEmissive.valid())						// Le rayon aléatoire sort de la scène
+						continue;
 
 					float profondeurEmissive = rayTriangleEmissive.tRayValue();								// Profondeur entre le point d'intersection et le triangle (source lumineuse)
 
 					Math::Vector3 positionPEmissive = reflectedRay.source() + reflectedRay.direction() * profondeurEmissive;		// Calcul du point d'intersection entre le point d'intersection et le triangle (source lumineuse)
 
-					Math::Vector3 rayonIncident = (positionPEmissive - positionP) / (positionPEmissive - positionP).norm();			// Calcul du rayon L = lumire - point d'intersection / || lumire - point d'intersection ||
+					Math::Vector3 versSource = positionPEmissive - positionP;							// Vecteur entre le point d'intersection et la source lumineuse
+					float dsource = versSource.norm();													// Calcul de la distance entre la source et le point d'intersection
+					Math::Vector3 rayonIncident = versSource / dsource;									// Calcul du rayon L = lumière - point d'intersection / || lumière - point d'intersection ||
 
-					float cos = (ray.direction()*(-1)) * (triangle->reflectionDirection(rayonIncident));		// Calcul des cosinus entre la normal et le rayon L
+					float cos = (ray.direction()*(-1)) * (hit.reflectionDirection(rayonIncident));		// Calcul des cosinus entre la normal et le rayon L
 
-					if (rayonIncident * triangle->normal() < 0)			// Retourne la direction de la normal au plan si elle est du mauvais ct
+					if (rayonIncident * hit.geometricNormal() < 0)			// Retourne la direction de la normal au plan si elle est du mauvais côté
 						cos = cos * -1;									// Inversion du cosinus		
 
-					float dsource = (positionPEmissive - positionP).norm();											// Calcul de la distance entre la source et le point d'intersection
 					RGBColor Id_source = ((Isource * couleurTriangle * (pow(cos, E))) / dsource) / nbRandomRay;		// Calcul des composantes speculaires de la source lumineuse
 						
 					emissiveSpeculare = emissiveSpeculare + Id_source;												// Calcul de la composante speculaire global : somme de toutes les composantes speculaires des sources lumineuses
@@ -498,58 +1516,64 @@ namespace Geometry
 		}
 	
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		/// \fn	RGBColor getRefractionId(RGBColor composante, float indiceRefraction, Math::Vector3 & ositionP, Math::Vector3 & dir_refraction, int depth, int maxDepth)
+		/// \fn	RGBColor getRefractionId(float indiceRefraction, Math::Vector3 const & positionP, Math::Vector3 const & dirRefraction, int depth, int maxDepth, Math::Random & random)
 		///
 		/// \brief	
 		/// 		
-		/// \author	L. Foucault & V. Goupoil, Universit de Rennes 1
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
 		/// \date	08/01/2016
 		///
 		/// \param	indiceRefraction		Indice de refraction du materiau.
 		///	\param	positionP				Position de l'intersection entre le rayon et le triangle.
-		///	\param	dirRefraction			Direction du rayon aprs refraction.
+		///	\param	dirRefraction			Direction du rayon après refraction.
 		///	\param	depth					Profondeur conrante du rebond.
 		///	\param	maxDepth				Profondeur maximale des rebonds.
+		///	\param	random					Generateur aleatoire de l'echantillon.
 		///
 		/// \return	La composante issue de la refraction du point d'intersection.
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		RGBColor getRefractionId(float indiceRefraction, Math::Vector3 & positionP, Math::Vector3 & dirRefraction, int depth, int maxDepth)
+		RGBColor getRefractionId(float indiceRefraction, Math::Vector3 const & positionP, Math::Vector3 const & dirRefraction, int depth, int maxDepth, Math::Random & random)
 		{
-			RGBColor refraction = (0, 0, 0);
+			RGBColor refraction(0, 0, 0);
 			Ray refractedRay(positionP, dirRefraction);
 
-			refraction = sendRay(refractedRay, depth, maxDepth, 0);
+			refraction = sendRay(refractedRay, depth, maxDepth, 0, random, System::RayStatistics::refractedRay);
 			
 			return refraction;
 		}
 
+	protected:
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		/// \fn	void Scene::compute(int maxDepth)
+		/// \fn	void Scene::render(int maxDepth, int nbRandomRay)
 		///
-		/// \brief	Computes a rendering of the current scene, viewed by the camera.
+		/// \brief	Renders the scene in the framebuffer (see Scene::compute). The visualizer is never
+		/// 		accessed.
 		/// 		
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	maxDepth	The maximum recursive depth.
+		/// \param	nbRandomRay	The number of random rays per hit (recursiveIntegrator) or of paths per
+		/// 					pixel (pathTracingIntegrator).
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		void compute(int maxDepth, int nbRandomRay)
+		void render(int maxDepth, int nbRandomRay)
 		{
+			if(m_progressiveMaxSamples > 0)
+			{
+				renderProgressive(maxDepth, nbRandomRay);
+				return;
+			}
 			// Number of samples per axis for one pixel. Number of samples per pixels = subPixelSubdivision^2
 			int subPixelDivision =  1; //50; //100;
 			// Step on x and y for subpixel sampling
 			float step = 1.0/subPixelDivision;
-			// Table accumulating values computed per pixel (enable rendering of each pass)
-			::std::vector<::std::vector<::std::pair<int, RGBColor> > > pixelTable(m_visu->width(), ::std::vector<::std::pair<int, RGBColor> >(m_visu->width(), ::std::make_pair(0, RGBColor())));
+			const int width = m_framebuffer.width();
+			const int height = m_framebuffer.height();
+			// Accumulates the values computed per pixel (enable rendering of each pass)
+			m_framebuffer.clear();
+			// Tiles of the image, distributed among the threads with work stealing
+			System::TileScheduler scheduler(width, height, m_framebuffer.tileSize());
 
-			// 1 - Rendering time
-			LARGE_INTEGER frequency;        // ticks per second
-			LARGE_INTEGER t1, t2;           // ticks
-			double elapsedTime;
-			// get ticks per second
-			QueryPerformanceFrequency(&frequency);
-			// start timer
-			QueryPerformanceCounter(&t1);
 			// Rendering pass number
 			int pass = 0;
 			// Rendering
@@ -559,34 +1583,524 @@ namespace Geometry
 				{
 					::std::cout<<"Pass: "<<pass<<::std::endl;
 					++pass ;
-					// Sends primary rays for each pixel (uncomment the pragma to parallelize rendering)
-#pragma omp parallel for //schedule(dynamic)
-					for(int y=0 ; y<m_visu->height() ; y++)
+					// Sends primary rays for each pixel, tile by tile
+					// One sampler per thread, restarted for each sample (only used by the path tracing)
+					scheduler.run(m_threadCount, [&]() { return ::std::unique_ptr<Math::Sampler>(m_integrator == pathTracingIntegrator ? createSampler() : NULL); },
+								  [&](::std::unique_ptr<Math::Sampler> & sampler, System::TileScheduler::Tile const & tile)
+					{
+						for(int y=tile.y0 ; y<tile.y1 ; y++)
+						{
+							for(int x=tile.x0 ; x<tile.x1 ; x++)
+							{
+								if(m_integrator == pathTracingIntegrator)
+								{
+									// One path per sample, samples are jittered in the pixel
+									for(int sample=0 ; sample<nbRandomRay ; sample++)
+									{
+										RGBColor result;
+										{
+											System::Profiler::Scope profile(System::Profiler::shading);
+											sampler->startSample(x, y, (pass-1)*nbRandomRay+sample);
+											float dx, dy ;
+											sampler->get2D(dx, dy);
+											dx -= 0.5f ;
+											dy -= 0.5f ;
+											result = tracePath(m_camera.getRay(((float)x+xp+dx*step)/width, ((float)y+yp+dy*step)/height), maxDepth, *sampler);
+										}
+										System::Profiler::Scope profile(System::Profiler::framebufferOutput);
+										m_framebuffer.add(x, y, result);
+									}
+								}
+								else
+								{
+									RGBColor result;
+									{
+										System::Profiler::Scope profile(System::Profiler::shading);
+										// Random number generator of this sample (independent of the thread computing it)
+										Math::Random random = Math::Random::forSample(y*width+x, pass-1, m_seed);
+										// Ray casting
+										result = sendRay(m_camera.getRay(((float)x+xp)/width, ((float)y+yp)/height), 0, maxDepth, nbRandomRay, random, System::RayStatistics::primaryRay);
+									}
+									// Accumulation of ray casting result in the associated pixel
+									System::Profiler::Scope profile(System::Profiler::framebufferOutput);
+									m_framebuffer.add(x, y, result);
+								}
+							}
+						}
+						publishTile(tile);
+					});
+					System::RayStatistics::instance().merge();
+				}
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	Math::Sampler * Scene::createSampler() const
+		///
+		/// \brief	Creates a sampler of the type selected by Scene::setSampler (one per rendering thread).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \return	The sampler, to be deleted by the caller.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		Math::Sampler * createSampler() const
+		{
+			switch(m_samplerType)
+			{
+			case sobolSampler:
+				return new Math::SobolSampler(m_seed);
+			case blueNoiseSampler:
+				return new Math::BlueNoiseSampler(m_seed);
+			default:
+				return new Math::IndependentSampler(m_framebuffer.width(), m_seed);
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	RGBColor Scene::samplePixel(Math::Sampler & sampler, int x, int y, unsigned int index, int maxDepth, int nbRandomRay)
+		///
+		/// \brief	Computes a sample jittered in a pixel with the current integrator (progressive rendering).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param [in,out]	sampler	The sampler.
+		/// \param	x			The column of the pixel.
+		/// \param	y			The row of the pixel.
+		/// \param	index		The index of the sample in the pixel.
+		/// \param	maxDepth	The maximum recursive depth.
+		/// \param	nbRandomRay	The number of random rays per hit (recursiveIntegrator).
+		///
+		/// \return	The sample.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		RGBColor samplePixel(Math::Sampler & sampler, int x, int y, unsigned int index, int maxDepth, int nbRandomRay)
+		{
+			System::Profiler::Scope profile(System::Profiler::shading);
+			const int width = m_framebuffer.width();
+			const int height = m_framebuffer.height();
+			sampler.startSample(x, y, index);
+			// Same pixel footprint as Scene::render: [x-1;x[ x [y-1;y[
+			float dx, dy ;
+			sampler.get2D(dx, dy);
+			Ray ray = m_camera.getRay(((float)x+dx-1.0f)/width, ((float)y+dy-1.0f)/height);
+			if(m_integrator == pathTracingIntegrator)
+				return tracePath(ray, maxDepth, sampler);
+			// The recursive integrator draws its random rays from a generator of another stream
+			Math::Random random = Math::Random::forSample(y*width+x, index, 2*m_seed+1);
+			return sendRay(ray, 0, maxDepth, nbRandomRay, random, System::RayStatistics::primaryRay);
+		}
+
+		/// \brief	Mixes the bits of a value in a 64 bits FNV-1a hash.
+		static void hashValue(unsigned long long & hash, float value)
+		{
+			unsigned int bits;
+			memcpy(&bits, &value, sizeof(bits));
+			for(int byte=0 ; byte<4 ; byte++)
+			{
+				hash ^= (bits >> (8*byte)) & 0xff;
+				hash *= 1099511628211ull;
+			}
+		}
+
+		/// \brief	Mixes the components of a vector or of a color in a hash.
+		template <class Vector>
+		static void hashVector(unsigned long long & hash, Vector const & vector)
+		{
+			for(int cpt=0 ; cpt<3 ; cpt++)
+				hashValue(hash, vector[cpt]);
+		}
+
+		/// \brief	Mixes the parameters of a material (or its absence) in a hash.
+		static void hashMaterial(unsigned long long & hash, const Material * material)
+		{
+			if(material == NULL)
+			{
+				hashValue(hash, -1.0f);
+				return;
+			}
+			hashVector(hash, material->ambientColor());
+			hashVector(hash, material->diffuseColor());
+			hashVector(hash, material->specularColor());
+			hashValue(hash, material->specularExponent());
+			hashVector(hash, material->emissiveColor());
+			hashValue(hash, material->indiceRefraction());
+		}
+
+		/// \brief	Mixes the triangles of a geometry and their materials in a hash.
+		static void hashGeometry(unsigned long long & hash, Geometry const & geometry)
+		{
+			const std::deque<Triangle, aligned_allocator<Triangle, 16> > & triangles = geometry.getTriangles();
+			for(size_t cpt=0 ; cpt<triangles.size() ; cpt++)
+			{
+				for(int vertex=0 ; vertex<3 ; vertex++)
+					hashVector(hash, triangles[cpt].vertex(vertex));
+				hashMaterial(hash, triangles[cpt].material());
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	unsigned long long Scene::sceneHash() const
+		///
+		/// \brief	Computes a hash of everything a checkpoint depends on besides the rendering parameters:
+		/// 		the triangles and materials of the geometries and of the meshes, the instances, the
+		/// 		lights and the camera (identified by the rays of the corners of the image).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \return	The hash.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		unsigned long long sceneHash() const
+		{
+			unsigned long long hash = 14695981039346656037ull;
+			for(int corner=0 ; corner<4 ; corner++)
+			{
+				Ray ray = m_camera.getRay((float)(corner&1), (float)(corner>>1));
+				hashVector(hash, ray.source());
+				hashVector(hash, ray.direction());
+			}
+			for(size_t cpt=0 ; cpt<m_lights.size() ; cpt++)
+			{
+				hashVector(hash, m_lights[cpt].position());
+				hashVector(hash, m_lights[cpt].color());
+			}
+			for(size_t cpt=0 ; cpt<m_geometries.size() ; cpt++)
+				hashGeometry(hash, m_geometries[cpt].second);
+			for(size_t cpt=0 ; cpt<m_meshes.size() ; cpt++)
+				hashGeometry(hash, m_meshes[cpt].second);
+			for(size_t cpt=0 ; cpt<m_instances.size() ; cpt++)
+			{
+				const Instance & instance = m_instances[cpt].second;
+				hashValue(hash, (float)instance.mesh());
+				// An affine transform is defined by the images of the origin and of the axes
+				hashVector(hash, instance.toWorld().transformPoint(Math::Vector3(0.0f, 0.0f, 0.0f)));
+				hashVector(hash, instance.toWorld().transformVector(Math::Vector3(1.0f, 0.0f, 0.0f)));
+				hashVector(hash, instance.toWorld().transformVector(Math::Vector3(0.0f, 1.0f, 0.0f)));
+				hashVector(hash, instance.toWorld().transformVector(Math::Vector3(0.0f, 0.0f, 1.0f)));
+				hashMaterial(hash, instance.material());
+			}
+			return hash;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	bool Scene::saveCheckpoint(Checkpoint const & checkpoint) const
+		///
+		/// \brief	Saves the progressive rendering in the checkpoint file. The file is written next to
+		/// 		the previous one, then replaces it.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	checkpoint	The state of the rendering.
+		///
+		/// \return	false if the file cannot be written.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		bool saveCheckpoint(Checkpoint const & checkpoint) const
+		{
+			System::Profiler::Scope profile(System::Profiler::framebufferOutput);
+			std::string temporary = m_checkpointFile + ".tmp";
+			FILE * file = fopen(temporary.c_str(), "wb");
+			if(file == NULL)
+				return false;
+			bool written = fwrite(&checkpoint, sizeof(Checkpoint), 1, file) == 1 && m_framebuffer.write(file);
+			written = fclose(file) == 0 && written;
+#ifdef _WIN32
+			bool moved = written && MoveFileExA(temporary.c_str(), m_checkpointFile.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+			// POSIX rename atomically replaces the previous checkpoint
+			bool moved = written && rename(temporary.c_str(), m_checkpointFile.c_str()) == 0;
+#endif
+			if(!moved)
+			{
+				remove(temporary.c_str());
+				return false;
+			}
+			return true;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	bool Scene::loadCheckpoint(Checkpoint & checkpoint)
+		///
+		/// \brief	Restores the progressive rendering saved in the checkpoint file, if it is a checkpoint
+		/// 		of the same rendering.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param [in,out]	checkpoint	The state of a new rendering, replaced by the saved one.
+		///
+		/// \return	false if there is no matching checkpoint (the rendering and the framebuffer are then
+		/// 		left unchanged).
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		bool loadCheckpoint(Checkpoint & checkpoint)
+		{
+			FILE * file = fopen(m_checkpointFile.c_str(), "rb");
+			if(file == NULL)
+				return false;
+			Checkpoint saved;
+			bool loaded = fread(&saved, sizeof(Checkpoint), 1, file) == 1 && saved.magic == checkpoint.magic && saved.version == checkpoint.version
+				&& saved.integrator == checkpoint.integrator && saved.sampler == checkpoint.sampler && saved.maxDepth == checkpoint.maxDepth
+				&& saved.nbRandomRay == checkpoint.nbRandomRay && saved.seed == checkpoint.seed && saved.adaptiveError == checkpoint.adaptiveError && saved.scene == checkpoint.scene
+				&& m_framebuffer.read(file);
+			fclose(file);
+			if(loaded)
+				checkpoint = saved;
+			return loaded;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Scene::renderProgressive(int maxDepth, int nbRandomRay)
+		///
+		/// \brief	Renders the scene in the framebuffer pass after pass (see
+		/// 		Scene::setProgressiveRendering), resuming the rendering saved in the checkpoint file if
+		/// 		any. With adaptive sampling (see Scene::setAdaptiveSampling), converged pixels are
+		/// 		skipped, so the following passes only spend rays on the noisy regions of the image. A
+		/// 		pixel is converged when the errors of its 3x3 neighbourhood are below the target: a
+		/// 		pixel whose first samples happen to be identical (e.g. on the edge of a light source) is
+		/// 		not stopped too early.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	maxDepth	The maximum recursive depth.
+		/// \param	nbRandomRay	The number of random rays per hit (recursiveIntegrator).
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void renderProgressive(int maxDepth, int nbRandomRay)
+		{
+			System::Timer timer;
+
+			const int width = m_framebuffer.width();
+			const int height = m_framebuffer.height();
+			m_framebuffer.clear();
+			System::TileScheduler scheduler(width, height, m_framebuffer.tileSize());
+			// Errors of the pixels at the beginning of the pass
+			::std::vector<float> errors(width*height, ::std::numeric_limits<float>::infinity());
+			// The samplers only depend on the pixel and on the sample index: the state of the rendering
+			// is the framebuffer and the index of the next sample
+			Checkpoint state = { s_checkpointMagic, s_checkpointVersion, m_integrator, m_samplerType, maxDepth, nbRandomRay, m_seed, m_adaptiveError, m_checkpointFile.empty() ? 0 : sceneHash(), 0, 0, 0, 0.0 };
+			if(!m_checkpointFile.empty() && loadCheckpoint(state))
+			{
+				::std::cout<<"Resuming "<<m_checkpointFile<<": pass "<<state.pass<<", "<<state.samples<<" samples per pixel"<<::std::endl;
+				System::TileScheduler::Tile image = { 0, 0, width, height };
+				publishTile(image);
+			}
+			const double previousTime = state.elapsedTime;
+			double checkpointTime = 0.0;
+			// Duration and number of samples per pixel of the previous pass
+			double passTime = 0.0;
+			int passCount = 0;
+			while(state.samples < m_progressiveMaxSamples)
+			{
+				int count = ::std::min(state.samples == 0 ? s_adaptiveMinSamples : s_adaptiveBatch, m_progressiveMaxSamples - state.samples);
+				// Stops before a pass which would end after the time budget (the previous pass sampled
+				// at least as many pixels, the estimation is pessimistic with adaptive sampling)
+				if(m_progressiveTimeBudget > 0.0 && (state.elapsedTime >= m_progressiveTimeBudget
+					|| (passCount > 0 && state.elapsedTime + passTime*count/passCount > m_progressiveTimeBudget)))
+					break;
+				const double passStart = timer.elapsed();
+				long long sampledPixels = 0;
+				::std::mutex mutex;
+				if(state.samples > 0 && (m_adaptiveError > 0.0f || m_progressiveError > 0.0f))
+				{
+					scheduler.run(m_threadCount, [&](System::TileScheduler::Tile const & tile)
+					{
+						for(int y=tile.y0 ; y<tile.y1 ; y++)
+						{
+							for(int x=tile.x0 ; x<tile.x1 ; x++)
+							{
+								errors[y*width+x] = m_framebuffer.error(x, y);
+							}
+						}
+					});
+					if(m_progressiveError > 0.0f)
+					{
+						double sum = 0.0;
+						for(size_t cpt=0 ; cpt<errors.size() ; cpt++)
+							sum += (double)errors[cpt]*errors[cpt];
+						if(sqrt(sum/errors.size()) <= m_progressiveError)
+							break;
+					}
+				}
+				// One sampler per thread, restarted for each sample
+				scheduler.run(m_threadCount, [&]() { return ::std::unique_ptr<Math::Sampler>(createSampler()); },
+							  [&](::std::unique_ptr<Math::Sampler> & sampler, System::TileScheduler::Tile const & tile)
+				{
+					long long tilePixels = 0;
+					for(int y=tile.y0 ; y<tile.y1 ; y++)
 					{
-						for(int x=0 ; x<m_visu->width() ; x++)
+						for(int x=tile.x0 ; x<tile.x1 ; x++)
 						{
-							// Ray casting
-							RGBColor result = sendRay(m_camera.getRay(((float)x+xp)/m_visu->width(), ((float)y+yp)/m_visu->height()), 0, maxDepth, nbRandomRay);
-							// Accumulation of ray casting result in the associated pixel
-							::std::pair<int, RGBColor> & currentPixel = pixelTable[x][y];
-							currentPixel.first++;
-							currentPixel.second = currentPixel.second + result;
-							// Pixel rendering (simple tone mapping)
-							m_visu->plot(x,y,pixelTable[x][y].second/pixelTable[x][y].first);
-							// Updates the rendering context (per pixel)
-							//m_visu->update();
+							if(m_adaptiveError > 0.0f)
+							{
+								float error = 0.0f;
+								for(int ny=::std::max(y-1, 0) ; ny<=::std::min(y+1, height-1) ; ny++)
+								{
+									for(int nx=::std::max(x-1, 0) ; nx<=::std::min(x+1, width-1) ; nx++)
+									{
+										error = ::std::max(error, errors[ny*width+nx]);
+									}
+								}
+								if(error <= m_adaptiveError)
+									continue;
+							}
+							for(int sample=0 ; sample<count ; sample++)
+							{
+								RGBColor result = samplePixel(*sampler, x, y, state.samples+sample, maxDepth, nbRandomRay);
+								System::Profiler::Scope profile(System::Profiler::framebufferOutput);
+								m_framebuffer.add(x, y, result);
+							}
+							tilePixels++;
 						}
-						// Updates the rendering context (per line)
-						m_visu->update();
 					}
-					// Updates the rendering context (per pass)
-					m_visu->update();
+					publishTile(tile);
+					::std::lock_guard<::std::mutex> lock(mutex);
+					sampledPixels += tilePixels;
+				});
+				System::RayStatistics::instance().merge();
+				::std::cout<<"Pass: "<<state.pass<<", "<<sampledPixels<<" pixels sampled"<<::std::endl;
+				state.pass++;
+				state.samples += count;
+				state.totalSamples += sampledPixels*count;
+				const double time = timer.elapsed();
+				state.elapsedTime = previousTime + time;
+				passTime = time - passStart;
+				passCount = count;
+				if(sampledPixels == 0)
+					break;
+				if(!m_checkpointFile.empty() && time - checkpointTime >= m_checkpointPeriod)
+				{
+					if(!saveCheckpoint(state))
+						::std::cerr<<"Cannot write the checkpoint "<<m_checkpointFile<<::std::endl;
+					checkpointTime = time;
+				}
+			}
+			// The final state is saved too: the rendering can be continued later with more samples
+			if(!m_checkpointFile.empty() && !saveCheckpoint(state))
+				::std::cerr<<"Cannot write the checkpoint "<<m_checkpointFile<<::std::endl;
+			::std::cout<<"Progressive rendering: "<<state.pass<<" passes, "<<state.totalSamples<<" samples, "<<(double)state.totalSamples/((double)width*height)<<" per pixel"<<::std::endl;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Scene::publishTile(System::TileScheduler::Tile const & tile)
+		///
+		/// \brief	Copies the pixels of a tile from the framebuffer to the displayed image. Called by the
+		/// 		thread which has just rendered the tile, the only one writing it during the pass.
+		/// 		Does nothing in headless mode.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	tile	The finished tile.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void publishTile(System::TileScheduler::Tile const & tile)
+		{
+			if(m_visu == NULL)
+				return;
+			const int width = m_framebuffer.width();
+			// The colors are computed before locking, the lock only covers the copy
+			::std::vector<RGBColor> pixels;
+			pixels.reserve((tile.x1-tile.x0)*(tile.y1-tile.y0));
+			for(int y=tile.y0 ; y<tile.y1 ; y++)
+				for(int x=tile.x0 ; x<tile.x1 ; x++)
+					pixels.push_back(m_framebuffer.pixel(x, y));
+			::std::lock_guard<::std::mutex> lock(m_displayMutex);
+			::std::vector<RGBColor>::const_iterator pixel = pixels.begin();
+			for(int y=tile.y0 ; y<tile.y1 ; y++)
+				for(int x=tile.x0 ; x<tile.x1 ; x++)
+					m_displayImage[y*width+x] = *pixel++;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Scene::display()
+		///
+		/// \brief	Copies the displayed image (the last published tiles) in the visualizer and refreshes
+		/// 		it. The framebuffer itself is never read while the rendering threads write it.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void display()
+		{
+			System::Profiler::Scope profile(System::Profiler::framebufferOutput);
+			::std::vector<RGBColor> image;
+			{
+				::std::lock_guard<::std::mutex> lock(m_displayMutex);
+				image = m_displayImage;
+			}
+			const int width = m_framebuffer.width();
+			for(int y=0 ; y<m_framebuffer.height() ; y++)
+			{
+				for(int x=0 ; x<width ; x++)
+				{
+					// Pixel rendering (simple tone mapping)
+					m_visu->plot(x, y, image[y*width+x]);
+				}
+			}
+			m_visu->update();
+		}
+
+	public:
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void Scene::compute(int maxDepth, int nbRandomRay)
+		///
+		/// \brief	Computes a rendering of the current scene, viewed by the camera (see
+		/// 		Scene::setIntegrator). The result is accumulated in the framebuffer. If the scene has a
+		/// 		visualizer, the rendering runs in a separate thread while the calling thread (owning the
+		/// 		window) displays the finished tiles every display period (see Scene::publishTile).
+		/// 		
+		/// \author	F. Lamarche, Université de Rennes 1
+		/// \date	04/12/2013
+		///
+		/// \param	maxDepth	The maximum recursive depth.
+		/// \param	nbRandomRay	The number of random rays per hit (recursiveIntegrator) or of paths per
+		/// 					pixel (pathTracingIntegrator).
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void compute(int maxDepth, int nbRandomRay)
+		{
+			System::Profiler & profiler = System::Profiler::instance();
+			profiler.reset();
+			profiler.setEnabled(!m_profileFile.empty());
+			System::RayStatistics & statistics = System::RayStatistics::instance();
+			statistics.reset();
+			statistics.setEnabled(m_rayStatistics);
+			System::Timer total;
+
+			// Updates the acceleration structures of the new or modified geometries
+			updateBVH();
+
+			// 1 - Rendering time
+			System::Timer timer;
+			if(m_visu == NULL)
+			{
+				render(maxDepth, nbRandomRay);
+			}
+			else
+			{
+				// The rendering threads never access the visualizer, this thread refreshes it
+				if(m_displayImage.size() != (size_t)m_framebuffer.width()*m_framebuffer.height())
+					m_displayImage.assign((size_t)m_framebuffer.width()*m_framebuffer.height(), RGBColor());
+				::std::future<void> rendering = ::std::async(::std::launch::async, [&]() { render(maxDepth, nbRandomRay); });
+				while(rendering.wait_for(::std::chrono::milliseconds(m_displayPeriod)) != ::std::future_status::ready)
+				{
+					display();
 				}
+				rendering.get();
+				display();
+			}
+			const double renderTime = timer.elapsed();
+			::std::cout<<"time: "<<renderTime<<"s. "<<::std::endl;
+			if(statistics.enabled())
+			{
+				statistics.setEnabled(false);
+				statistics.print(::std::cout, renderTime);
+			}
+			if(profiler.enabled())
+			{
+				profiler.setEnabled(false);
+				if(!profiler.writeReport(m_profileFile, total.elapsed()))
+					::std::cerr<<"Cannot write the profile "<<m_profileFile<<::std::endl;
 			}
-			// stop timer
-			QueryPerformanceCounter(&t2);
-			elapsedTime = (t2.QuadPart - t1.QuadPart) / frequency.QuadPart;
-			::std::cout<<"time: "<<elapsedTime<<"s. "<<::std::endl;
 		}
 	};
 }
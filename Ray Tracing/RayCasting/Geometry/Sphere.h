@@ -10,14 +10,14 @@
 
 namespace Geometry
 {
-	/** \brief Reprsentation d'une sphere */
+	/** \brief Représentation d'une sphere */
 
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// \class	Sphere
 	///
 	/// \brief	A sphere, centered in (0,0,0), 1.0 radius.
 	///
-	/// \author	Ific Goud, ESIR 2
+	/// \author	Ific Goudé, ESIR 2
 	/// \date	16/12/2015
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	class Sphere : public Geometry
@@ -29,7 +29,7 @@ namespace Geometry
 		///
 		/// \brief	Constructor.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	nbDiv   	Number of base circle subdivisions.
@@ -5,14 +5,14 @@
 
 namespace Geometry
 {
-	/** \brief Classe reprsentant la gomtrie d'un carr */
+	/** \brief Classe représentant la géométrie d'un carré */
 
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// \class	Square
 	///
 	/// \brief	A square on plane (X,Y), centered in (0,0,0).
 	///
-	/// \author	F. Lamarche, Universit de Rennes 1
+	/// \author	F. Lamarche, Université de Rennes 1
 	/// \date	04/12/2013
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	class Square : public Geometry
@@ -24,7 +24,7 @@ namespace Geometry
 		///
 		/// \brief	Constructor.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param [in,out]	material	If non-null, the material.
@@ -2,6 +2,7 @@
 #define _Geometry_Triangle
 
 #include <Math/Vector3.h>
+#include <Math/Transform.h>
 #include <Geometry/Ray.h>
 #include <Geometry/Material.h>
 
@@ -12,7 +13,7 @@ namespace Geometry
 	///
 	/// \brief	A triangle.
 	///
-	/// \author	F. Lamarche, Universit de Rennes 1
+	/// \author	F. Lamarche, Université de Rennes 1
 	/// \date	04/12/2013
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	class Triangle
@@ -30,6 +31,8 @@ namespace Geometry
 		Math::Vector3 m_normal ;
 		/// \brief	The associated material.
 		Material * m_material ;
+		/// \brief	The index of the material in the material table of the scene, read by the shading.
+		unsigned short m_materialId ;
 
 	public:
 		////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -38,7 +41,7 @@ namespace Geometry
 		/// \brief	Updates precomputed data. This method should be called if vertices are externally 
 		/// 		modified.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		////////////////////////////////////////////////////////////////////////////////////////////////////
 		void update()
@@ -56,7 +59,7 @@ namespace Geometry
 		///
 		/// \brief	Constructor.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	a					A pointer to the first vertex.
@@ -65,7 +68,7 @@ namespace Geometry
 		/// \param [in,out]	material	If non-null, the material.
 		////////////////////////////////////////////////////////////////////////////////////////////////////
 		Triangle(Math::Vector3 * a, Math::Vector3 * b, Math::Vector3 * c, Material * material)
-			: m_material(material)
+			: m_material(material), m_materialId(Material::s_noMaterial)
 		{
 			m_vertex[0] = a ;
 			m_vertex[1] = b ;
@@ -78,22 +81,71 @@ namespace Geometry
 		///
 		/// \brief	Default constructor.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		////////////////////////////////////////////////////////////////////////////////////////////////////
 		Triangle()
+			: m_material(NULL), m_materialId(Material::s_noMaterial)
 		{
 			m_vertex[0] = NULL ;
 			m_vertex[1] = NULL ;
 			m_vertex[2] = NULL ;
 		}
 
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	Triangle Triangle::transformed(Math::Transform const & transform, Material * material,
+		/// 	unsigned short materialId) const
+		///
+		/// \brief	Computes the image of this triangle by a transformation (used to shade the triangles of
+		/// 		an instance in world space). The result does not reference any vertex: vertex() must not
+		/// 		be called on it.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	transform 	The transformation.
+		/// \param	material  	The material of the result (NULL keeps the material of this triangle).
+		/// \param	materialId	The index of material in the material table (ignored if material is NULL).
+		///
+		/// \return	The transformed triangle.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		Triangle transformed(Math::Transform const & transform, Material * material, unsigned short materialId) const
+		{
+			Triangle result ;
+			result.m_vertex0 = transform.transformPoint(m_vertex0) ;
+			result.m_uAxis = transform.transformVector(m_uAxis) ;
+			result.m_vAxis = transform.transformVector(m_vAxis) ;
+			result.m_normal = transformedNormal(transform) ;
+			result.m_material = (material!=NULL) ? material : m_material ;
+			result.m_materialId = (material!=NULL) ? materialId : m_materialId ;
+			return result ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	Math::Vector3 Triangle::transformedNormal(Math::Transform const & transform) const
+		///
+		/// \brief	Computes the normal of the image of this triangle by a transformation (used to shade
+		/// 		the triangles of an instance in world space, see HitRecord).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	transform	The transformation.
+		///
+		/// \return	The unit normal of the transformed triangle.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		Math::Vector3 transformedNormal(Math::Transform const & transform) const
+		{
+			Math::Vector3 normal = transform.transformVector(m_uAxis)^transform.transformVector(m_vAxis) ;
+			return normal*(1.0f/normal.norm()) ;
+		}
+
 		////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// \fn	Material * Triangle::material() const
 		///
 		/// \brief	Gets the material.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \return	null if it fails, else.
@@ -101,12 +153,30 @@ namespace Geometry
 		Material * material() const
 		{ return m_material ; }
 
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	unsigned short Triangle::materialId() const
+		///
+		/// \brief	Gets the index of the material in the material table of the scene (see
+		/// 		Scene::updateMaterials).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \return	The index, Material::s_noMaterial until the scene has assigned it.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		unsigned short materialId() const
+		{ return m_materialId ; }
+
+		/// \brief	Sets the index of the material in the material table of the scene.
+		void setMaterialId(unsigned short materialId)
+		{ m_materialId = materialId ; }
+
 		////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// \fn	Math::Vector3 const & Triangle::vertex(int i) const
 		///
 		/// \brief	Gets the ith vertex
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	i	Vertex index in [0;2].
@@ -123,7 +193,7 @@ namespace Geometry
 		///
 		/// \brief	Gets the u axis.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \return	.
@@ -138,7 +208,7 @@ namespace Geometry
 		///
 		/// \brief	Gets the v axis.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \return	.
@@ -153,7 +223,7 @@ namespace Geometry
 		///
 		/// \brief	Gets the normal.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \return	.
@@ -161,12 +231,44 @@ namespace Geometry
 		const Math::Vector3 & normal() const
 		{ return m_normal ; }
 
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	float Triangle::area() const
+		///
+		/// \brief	Gets the area.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \return	The area.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		float area() const
+		{ return 0.5f*(m_uAxis^m_vAxis).norm() ; }
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	Math::Vector3 Triangle::samplePoint(float u1, float u2) const
+		///
+		/// \brief	Maps two uniform values to a point uniformly distributed on the triangle.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	u1	Uniform value in [0;1[.
+		/// \param	u2	Uniform value in [0;1[.
+		///
+		/// \return	The point.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		Math::Vector3 samplePoint(float u1, float u2) const
+		{
+			float su1 = sqrtf(u1) ;
+			return m_vertex0 + m_uAxis*(su1*(1.0f-u2)) + m_vAxis*(su1*u2) ;
+		}
+
 		////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// \fn	Math::Vector3 Triangle::normal(Math::Vector3 const & point) const
 		///
 		/// \brief	Gets the normal directed toward the half space containing the provided point.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	point	The point.
@@ -186,7 +288,7 @@ namespace Geometry
 		///
 		/// \brief Returns the direction of a reflected ray, from the direction of the incident ray.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	dir	The direction of the incident ray.
@@ -204,7 +306,7 @@ namespace Geometry
 		///
 		/// \brief	Returns the direction of the reflected ray from a ray description.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	ray	The incident ray.
@@ -226,7 +328,7 @@ namespace Geometry
 		///
 		/// \brief	Computes the intersection between a ray and this triangle.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	r		 	The tested ray.
@@ -323,7 +425,7 @@ namespace Geometry
 		///
 		/// \brief	Computes the intersection between the ray and the plane supporting the triangle.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	r	The ray.
@@ -0,0 +1,394 @@
+#ifndef _Geometry_TriangleBVH_H
+#define _Geometry_TriangleBVH_H
+
+#include <Geometry/BVH.h>
+#include <Geometry/WideBVH.h>
+#include <Geometry/BoundingBox.h>
+#include <Geometry/Geometry.h>
+#include <Geometry/Instance.h>
+#include <Geometry/Triangle.h>
+#include <Geometry/TrianglePack.h>
+#include <System/aligned_allocator.h>
+#include <vector>
+
+namespace Geometry
+{
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \class	TraversalCounters
+	///
+	/// \brief	Work of the traversal of a ray, counted by the triangle intersectors: the nodes visited
+	/// 		in all the hierarchies (see WideBVH::traverse) and the triangles tested (all the slots of
+	/// 		each tested pack).
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	class TraversalCounters
+	{
+	protected:
+		/// \brief	Number of visited nodes.
+		int m_nodes ;
+		/// \brief	Number of tested triangles.
+		int m_triangles ;
+
+	public:
+		TraversalCounters()
+			: m_nodes(0), m_triangles(0)
+		{}
+
+		/// \brief	Notifies the visit of nodes of a hierarchy.
+		void visitNodes(int count)
+		{ m_nodes += count ; }
+
+		/// \brief	Number of visited nodes.
+		int nodes() const
+		{ return m_nodes ; }
+
+		/// \brief	Number of tested triangles.
+		int triangles() const
+		{ return m_triangles ; }
+	} ;
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \class	ClosestTriangle
+	///
+	/// \brief	Triangle intersector that keeps track of the nearest triangle intersected by a ray. It is
+	/// 		used as a functor during the traversal of a TriangleBVH.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	class ClosestTriangle : public TraversalCounters
+	{
+	protected:
+		/// \brief	The nearest triangle found so far (NULL if none).
+		const Triangle * m_triangle ;
+		/// \brief	The u coordinate of the nearest intersection.
+		float m_u ;
+		/// \brief	The v coordinate of the nearest intersection.
+		float m_v ;
+		/// \brief	The instance of the nearest triangle (NULL if it belongs to a plain geometry).
+		const Instance * m_instance ;
+		/// \brief	The instance being traversed (see setInstance).
+		const Instance * m_currentInstance ;
+
+	public:
+		ClosestTriangle()
+			: m_triangle(NULL), m_u(0.0f), m_v(0.0f), m_instance(NULL), m_currentInstance(NULL)
+		{}
+
+		/// \brief	Notifies that the following packs belong to the mesh of an instance (NULL for a plain
+		/// 		geometry). The ray is then expressed in the object space of the instance.
+		void setInstance(const Instance * instance)
+		{ m_currentInstance = instance ; }
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	bool ClosestTriangle::operator() (Ray const & ray, SceneTrianglePack const & pack,
+		/// 	float & tMax)
+		///
+		/// \brief	Intersects the triangles of the provided pack and records the nearest one if it is
+		/// 		closer than tMax.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	ray					The ray.
+		/// \param	pack				The triangles.
+		/// \param [in,out]	tMax	The distance of the nearest intersection found so far.
+		///
+		/// \return	false (the traversal should go on).
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		bool operator() (Ray const & ray, SceneTrianglePack const & pack, float & tMax)
+		{
+			int index ;
+			float u, v ;
+			m_triangles += SceneTrianglePack::s_width ;
+			if(pack.intersect(ray, tMax, index, u, v))
+			{
+				m_triangle = pack.triangle(index) ;
+				m_instance = m_currentInstance ;
+				m_u = u ;
+				m_v = v ;
+			}
+			return false ;
+		}
+
+		/// \brief	The nearest triangle found so far (NULL if none).
+		const Triangle * triangle() const
+		{ return m_triangle ; }
+
+		/// \brief	The instance of the nearest triangle (NULL if it belongs to a plain geometry).
+		const Instance * instance() const
+		{ return m_instance ; }
+
+		/// \brief	The u coordinate of the nearest intersection.
+		float u() const
+		{ return m_u ; }
+
+		/// \brief	The v coordinate of the nearest intersection.
+		float v() const
+		{ return m_v ; }
+	} ;
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \class	AnyTriangle
+	///
+	/// \brief	Triangle intersector used for occlusion queries: the traversal stops as soon as a
+	/// 		triangle is intersected before tMax. Neither the triangle nor the distance are recorded.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	class AnyTriangle : public TraversalCounters
+	{
+	public:
+		/// \brief	See ClosestTriangle::setInstance (the instance is not needed to detect occlusions).
+		void setInstance(const Instance *)
+		{}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	bool AnyTriangle::operator() (Ray const & ray, SceneTrianglePack const & pack,
+		/// 	float & tMax)
+		///
+		/// \brief	Tests if a triangle of the provided pack is intersected before tMax.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	ray			The ray.
+		/// \param	pack		The triangles.
+		/// \param	tMax		The distance of interest (left unchanged).
+		///
+		/// \return	true if a triangle is intersected (the traversal should stop).
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		bool operator() (Ray const & ray, SceneTrianglePack const & pack, float & tMax)
+		{
+			m_triangles += SceneTrianglePack::s_width ;
+			return pack.occludes(ray, tMax) ;
+		}
+	} ;
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \class	TriangleBVH
+	///
+	/// \brief	Bottom level acceleration structure: a bounding volume hierarchy over the triangles of a
+	/// 		single geometry. The triangles of each leaf are stored in a SceneTrianglePack so that they
+	/// 		are intersected at once. TriangleBVH::update keeps it in sync with the geometry: the
+	/// 		hierarchy is refitted when the vertices have moved and rebuilt when the topology has
+	/// 		changed or when refitting has degraded it too much.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	class TriangleBVH
+	{
+	protected:
+		/// \brief	The triangle packs (one per leaf, indexed by the primitive indices of the hierarchy).
+		::std::vector<SceneTrianglePack, aligned_allocator<SceneTrianglePack, SceneTrianglePack::s_alignment> > m_packs ;
+		/// \brief	The hierarchy.
+		SceneBVH m_bvh ;
+		/// \brief	Is the hierarchy up to date with the geometry?
+		bool m_upToDate ;
+		/// \brief	SAH cost of the hierarchy in its current state, updated by each refit (see WideBVH::sahCost).
+		float m_sahCost ;
+		/// \brief	SAH cost of the wide hierarchy right after the last build (see WideBVH::sahCost).
+		float m_builtSahCost ;
+		/// \brief	Vertex revision of the geometry the hierarchy bounds (see Geometry::vertexRevision).
+		unsigned int m_vertexRevision ;
+		/// \brief	Topology revision of the geometry the hierarchy was built for.
+		unsigned int m_topologyRevision ;
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \class	Adaptor
+		///
+		/// \brief	Adapts a triangle intersector to the primitive indices used by SceneBVH::traverse.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		template <class TriangleIntersector>
+		class Adaptor
+		{
+		protected:
+			const ::std::vector<SceneTrianglePack, aligned_allocator<SceneTrianglePack, SceneTrianglePack::s_alignment> > & m_packs ;
+			const Ray & m_ray ;
+			TriangleIntersector & m_intersector ;
+		public:
+			Adaptor(const ::std::vector<SceneTrianglePack, aligned_allocator<SceneTrianglePack, SceneTrianglePack::s_alignment> > & packs, const Ray & ray, TriangleIntersector & intersector)
+				: m_packs(packs), m_ray(ray), m_intersector(intersector)
+			{}
+
+			bool operator() (int primitive, float & tMax)
+			{ return m_intersector(m_ray, m_packs[primitive], tMax) ; }
+
+			void visitNodes(int count)
+			{ m_intersector.visitNodes(count) ; }
+		} ;
+
+	public:
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	TriangleBVH::TriangleBVH()
+		///
+		/// \brief	Default constructor (the hierarchy has to be built).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		TriangleBVH()
+			: m_upToDate(false), m_sahCost(0.0f), m_builtSahCost(0.0f), m_vertexRevision(0), m_topologyRevision(0)
+		{}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void TriangleBVH::build(Geometry const & geometry, BVH::BuildMode mode)
+		///
+		/// \brief	Builds the hierarchy over the triangles of the provided geometry. The geometry must
+		/// 		outlive this structure.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	geometry	The geometry.
+		/// \param	mode		The build algorithm.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void build(Geometry const & geometry, BVH::BuildMode mode = BVH::highQualityBuild)
+		{
+			const ::std::deque<Triangle, aligned_allocator<Triangle, 16> > & triangles = geometry.getTriangles() ;
+			::std::vector<BoundingBox, aligned_allocator<BoundingBox, 16> > boxes ;
+			boxes.reserve(triangles.size()) ;
+			for(int cpt=0 ; cpt<(int)triangles.size() ; ++cpt)
+			{
+				boxes.push_back(BoundingBox(triangles[cpt])) ;
+			}
+			BVH bvh ;
+			bvh.build(boxes, SceneTrianglePack::s_width, mode) ;
+			// The triangles of each leaf are gathered in a pack, packs are stored in leaf order
+			::std::vector<int> primitives = bvh.primitives() ;
+			::std::vector< ::std::pair<int, int> > leaves ;
+			bvh.groupLeaves(leaves) ;
+			m_packs.assign(leaves.size(), SceneTrianglePack()) ;
+			for(int leaf=0 ; leaf<(int)leaves.size() ; ++leaf)
+			{
+				for(int cpt=0 ; cpt<leaves[leaf].second ; ++cpt)
+				{
+					m_packs[leaf].set(cpt, &triangles[primitives[leaves[leaf].first+cpt]]) ;
+				}
+			}
+			m_bvh.build(bvh) ;
+			m_builtSahCost = m_bvh.sahCost() ;
+			m_sahCost = m_builtSahCost ;
+			m_vertexRevision = geometry.vertexRevision() ;
+			m_topologyRevision = geometry.topologyRevision() ;
+			m_upToDate = true ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	bool TriangleBVH::refit(Geometry const & geometry, float maxDegradation)
+		///
+		/// \brief	Updates the bounds of the hierarchy after the vertices of the geometry have been moved
+		/// 		(the triangles must be the ones used by the last build).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	geometry	  	The geometry.
+		/// \param	maxDegradation	Maximum ratio between the SAH cost of the refitted hierarchy and the
+		/// 						one right after the build.
+		///
+		/// \return	false if the hierarchy has degraded past maxDegradation and should be rebuilt.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		bool refit(Geometry const & geometry, float maxDegradation)
+		{
+			::std::vector<BoundingBox, aligned_allocator<BoundingBox, 16> > boxes(m_packs.size()) ;
+			for(int cpt=0 ; cpt<(int)m_packs.size() ; ++cpt)
+			{
+				boxes[cpt] = m_packs[cpt].update() ;
+			}
+			m_bvh.refit(boxes) ;
+			m_sahCost = m_bvh.sahCost() ;
+			m_vertexRevision = geometry.vertexRevision() ;
+			return m_sahCost <= m_builtSahCost*maxDegradation ;
+		}
+
+		/// \brief	Result of TriangleBVH::update.
+		enum UpdateResult { unchanged, refitted, rebuilt } ;
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	UpdateResult TriangleBVH::update(Geometry const & geometry, BVH::BuildMode mode,
+		/// 	float maxDegradation)
+		///
+		/// \brief	Brings the hierarchy up to date with the geometry: it is rebuilt if it has been
+		/// 		invalidated or if triangles have been added, refitted if the vertices have been moved.
+		/// 		A refit that degrades the hierarchy past maxDegradation is followed by a rebuild.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	geometry	  	The geometry.
+		/// \param	mode		  	The build algorithm.
+		/// \param	maxDegradation	See TriangleBVH::refit.
+		///
+		/// \return	What has been done.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		UpdateResult update(Geometry const & geometry, BVH::BuildMode mode, float maxDegradation)
+		{
+			if(m_upToDate && m_topologyRevision==geometry.topologyRevision())
+			{
+				if(m_vertexRevision==geometry.vertexRevision())
+				{
+					return unchanged ;
+				}
+				if(refit(geometry, maxDegradation))
+				{
+					return refitted ;
+				}
+			}
+			build(geometry, mode) ;
+			return rebuilt ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void TriangleBVH::invalidate()
+		///
+		/// \brief	Notifies that the geometry has been modified: the hierarchy should be rebuilt.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void invalidate()
+		{ m_upToDate = false ; }
+
+		/// \brief	The hierarchy.
+		const SceneBVH & bvh() const
+		{ return m_bvh ; }
+
+		/// \brief	SAH cost of the hierarchy after the last build or refit (see WideBVH::sahCost).
+		float sahCost() const
+		{ return m_sahCost ; }
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	template <class TriangleIntersector> bool TriangleBVH::traverse(Ray const & ray,
+		/// 	float & tMax, TriangleIntersector & intersector) const
+		///
+		/// \brief	Traverses the hierarchy. The intersector is called as intersector(ray, pack, tMax) for
+		/// 		the triangle pack of each visited leaf (see WideBVH::traverse for the semantic of tMax
+		/// 		and of the returned value).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	ray						The ray.
+		/// \param [in,out]	tMax			The maximum distance of interest along the ray.
+		/// \param [in,out]	intersector		The triangle intersector.
+		///
+		/// \return	true if the traversal has been stopped by the intersector.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		template <class TriangleIntersector>
+		bool traverse(Ray const & ray, float & tMax, TriangleIntersector & intersector) const
+		{
+			Adaptor<TriangleIntersector> adaptor(m_packs, ray, intersector) ;
+			return m_bvh.traverse(ray, tMax, adaptor) ;
+		}
+	} ;
+}
+
+#endif
@@ -0,0 +1,338 @@
+#ifndef _Geometry_TrianglePack_H
+#define _Geometry_TrianglePack_H
+
+#include <Geometry/Triangle.h>
+#include <Geometry/Ray.h>
+#include <Geometry/BoundingBox.h>
+#include <math.h>
+
+#ifdef SSE_OPT
+#include <Math/sse/Float4_functions.h>
+#endif
+#ifdef AVX_OPT
+#include <Math/sse/Float8_functions.h>
+#endif
+
+namespace Geometry
+{
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \class	TrianglePackTest
+	///
+	/// \brief	Möller-Trumbore intersection between a ray and Width triangles stored in structure of
+	/// 		arrays form: nine rows of Width floats (vertex 0 x, y, z, u axis x, y, z, v axis x, y, z).
+	/// 		The generic version is scalar, the 4 wide (SSE_OPT) and 8 wide (AVX_OPT) versions test
+	/// 		all the triangles at once. The tests are the ones of Triangle::intersection.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	template <int Width>
+	class TrianglePackTest
+	{
+	public:
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	static int TrianglePackTest::intersect(const float * data, Ray const & ray, float tMax,
+		/// 	float * t, float * u, float * v)
+		///
+		/// \brief	Intersects the triangles with the ray in the interval [0.0001;tMax[.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	data		The triangles (9 rows of Width floats, suitably aligned).
+		/// \param	ray			The ray.
+		/// \param	tMax		The upper bound of the tested interval.
+		/// \param [out]	t	The distance of the intersection with each triangle (Width floats,
+		/// 					suitably aligned).
+		/// \param [out]	u	The u coordinate of each intersection (idem).
+		/// \param [out]	v	The v coordinate of each intersection (idem).
+		///
+		/// \return	A mask whose bit i is set if the ray intersects triangle i.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		static int intersect(const float * data, Ray const & ray, float tMax, float * t, float * u, float * v)
+		{
+			int mask = 0 ;
+			for(int cpt=0 ; cpt<Width ; ++cpt)
+			{
+				Math::Vector3 vertex0(data[cpt], data[Width+cpt], data[2*Width+cpt]) ;
+				Math::Vector3 edge1(data[3*Width+cpt], data[4*Width+cpt], data[5*Width+cpt]) ;
+				Math::Vector3 edge2(data[6*Width+cpt], data[7*Width+cpt], data[8*Width+cpt]) ;
+
+				Math::Vector3 pvec(ray.direction() ^ edge2) ;
+				float det = edge1 * pvec ;
+				if(fabs(det)<0.000000001) { continue ; }
+				float inv_det = 1.0f / det ;
+
+				Math::Vector3 tvec(ray.source() - vertex0) ;
+				u[cpt] = (tvec * pvec) * inv_det ;
+				if(u[cpt]<0.0f || u[cpt]>1.0f) { continue ; }
+
+				Math::Vector3 qvec(tvec ^ edge1) ;
+				v[cpt] = (ray.direction() * qvec) * inv_det ;
+				if(v[cpt]<0.0f || u[cpt]+v[cpt]>1.0f) { continue ; }
+
+				t[cpt] = (edge2 * qvec) * inv_det ;
+				if(t[cpt]>=0.0001f && t[cpt]<tMax) { mask |= 1<<cpt ; }
+			}
+			return mask ;
+		}
+	} ;
+
+#ifdef SSE_OPT
+	template <>
+	class TrianglePackTest<4>
+	{
+	public:
+		static int intersect(const float * data, Ray const & ray, float tMax, float * t, float * u, float * v)
+		{
+			Math::sse::Float4 dx = makeFloat4(ray.direction()[0]) ;
+			Math::sse::Float4 dy = makeFloat4(ray.direction()[1]) ;
+			Math::sse::Float4 dz = makeFloat4(ray.direction()[2]) ;
+			Math::sse::Float4 e1x = loadFloat4(data+12), e1y = loadFloat4(data+16), e1z = loadFloat4(data+20) ;
+			Math::sse::Float4 e2x = loadFloat4(data+24), e2y = loadFloat4(data+28), e2z = loadFloat4(data+32) ;
+
+			// pvec = direction ^ edge2
+			Math::sse::Float4 px = dy*e2z - dz*e2y ;
+			Math::sse::Float4 py = dz*e2x - dx*e2z ;
+			Math::sse::Float4 pz = dx*e2y - dy*e2x ;
+			Math::sse::Float4 det = e1x*px + e1y*py + e1z*pz ;
+			Math::sse::Float4 invDet = makeFloat4(1.0f)/det ;
+
+			// tvec = source - vertex0
+			Math::sse::Float4 tx = makeFloat4(ray.source()[0]) - loadFloat4(data) ;
+			Math::sse::Float4 ty = makeFloat4(ray.source()[1]) - loadFloat4(data+4) ;
+			Math::sse::Float4 tz = makeFloat4(ray.source()[2]) - loadFloat4(data+8) ;
+			Math::sse::Float4 uu = (tx*px + ty*py + tz*pz)*invDet ;
+
+			// qvec = tvec ^ edge1
+			Math::sse::Float4 qx = ty*e1z - tz*e1y ;
+			Math::sse::Float4 qy = tz*e1x - tx*e1z ;
+			Math::sse::Float4 qz = tx*e1y - ty*e1x ;
+			Math::sse::Float4 vv = (dx*qx + dy*qy + dz*qz)*invDet ;
+			Math::sse::Float4 tt = (e2x*qx + e2y*qy + e2z*qz)*invDet ;
+
+			Math::sse::Float4 zero = makeFloat4(0.0f) ;
+			Math::sse::Float4 valid = simdGreaterEquals(abs(det), makeFloat4(0.000000001f))
+				& simdGreaterEquals(uu, zero) & simdLessEquals(uu, makeFloat4(1.0f))
+				& simdGreaterEquals(vv, zero) & simdLessEquals(uu+vv, makeFloat4(1.0f))
+				& simdGreaterEquals(tt, makeFloat4(0.0001f)) & simdLess(tt, makeFloat4(tMax)) ;
+			store(t, tt) ;
+			store(u, uu) ;
+			store(v, vv) ;
+			return signMask(valid) ;
+		}
+	} ;
+#endif
+
+#ifdef AVX_OPT
+	template <>
+	class TrianglePackTest<8>
+	{
+	public:
+		static int intersect(const float * data, Ray const & ray, float tMax, float * t, float * u, float * v)
+		{
+			Math::sse::Float8 dx = makeFloat8(ray.direction()[0]) ;
+			Math::sse::Float8 dy = makeFloat8(ray.direction()[1]) ;
+			Math::sse::Float8 dz = makeFloat8(ray.direction()[2]) ;
+			Math::sse::Float8 e1x = loadFloat8(data+24), e1y = loadFloat8(data+32), e1z = loadFloat8(data+40) ;
+			Math::sse::Float8 e2x = loadFloat8(data+48), e2y = loadFloat8(data+56), e2z = loadFloat8(data+64) ;
+
+			// pvec = direction ^ edge2
+			Math::sse::Float8 px = dy*e2z - dz*e2y ;
+			Math::sse::Float8 py = dz*e2x - dx*e2z ;
+			Math::sse::Float8 pz = dx*e2y - dy*e2x ;
+			Math::sse::Float8 det = e1x*px + e1y*py + e1z*pz ;
+			Math::sse::Float8 invDet = makeFloat8(1.0f)/det ;
+
+			// tvec = source - vertex0
+			Math::sse::Float8 tx = makeFloat8(ray.source()[0]) - loadFloat8(data) ;
+			Math::sse::Float8 ty = makeFloat8(ray.source()[1]) - loadFloat8(data+8) ;
+			Math::sse::Float8 tz = makeFloat8(ray.source()[2]) - loadFloat8(data+16) ;
+			Math::sse::Float8 uu = (tx*px + ty*py + tz*pz)*invDet ;
+
+			// qvec = tvec ^ edge1
+			Math::sse::Float8 qx = ty*e1z - tz*e1y ;
+			Math::sse::Float8 qy = tz*e1x - tx*e1z ;
+			Math::sse::Float8 qz = tx*e1y - ty*e1x ;
+			Math::sse::Float8 vv = (dx*qx + dy*qy + dz*qz)*invDet ;
+			Math::sse::Float8 tt = (e2x*qx + e2y*qy + e2z*qz)*invDet ;
+
+			Math::sse::Float8 zero = makeFloat8(0.0f) ;
+			Math::sse::Float8 valid = simdGreaterEquals(abs(det), makeFloat8(0.000000001f))
+				& simdGreaterEquals(uu, zero) & simdLessEquals(uu, makeFloat8(1.0f))
+				& simdGreaterEquals(vv, zero) & simdLessEquals(uu+vv, makeFloat8(1.0f))
+				& simdGreaterEquals(tt, makeFloat8(0.0001f)) & simdLess(tt, makeFloat8(tMax)) ;
+			store(t, tt) ;
+			store(u, uu) ;
+			store(v, vv) ;
+			return signMask(valid) ;
+		}
+	} ;
+#endif
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \class	TrianglePack
+	///
+	/// \brief	Up to Width triangles whose vertex 0 and edges are stored in structure of arrays form, so
+	/// 		that they are intersected with a ray at once (see TrianglePackTest). Unused slots hold
+	/// 		degenerated triangles that are never intersected. A pack only references the triangles
+	/// 		it has been built from (used for shading).
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	template <int Width>
+	class TrianglePack
+	{
+	public:
+		/// \brief	Maximum number of triangles in a pack.
+		static const int s_width = Width ;
+		/// \brief	Alignment of the packs (required by the SIMD loads).
+		static const int s_alignment = Width*4 ;
+
+	protected:
+		/// \brief	Vertex 0, u axis and v axis of the triangles: nine rows of Width floats.
+		float m_data[9*Width] ;
+		/// \brief	The triangles (NULL for unused slots).
+		const Triangle * m_triangles[Width] ;
+
+	public:
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	TrianglePack::TrianglePack()
+		///
+		/// \brief	Default constructor (empty pack).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		TrianglePack()
+		{
+			for(int cpt=0 ; cpt<9*Width ; ++cpt)
+			{
+				m_data[cpt] = 0.0f ;
+			}
+			for(int cpt=0 ; cpt<Width ; ++cpt)
+			{
+				m_triangles[cpt] = NULL ;
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void TrianglePack::set(int i, const Triangle * triangle)
+		///
+		/// \brief	Stores a triangle in slot i.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	i			The slot.
+		/// \param	triangle	The triangle.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void set(int i, const Triangle * triangle)
+		{
+			for(int axis=0 ; axis<3 ; ++axis)
+			{
+				m_data[axis*Width+i] = triangle->vertex(0)[axis] ;
+				m_data[(3+axis)*Width+i] = triangle->uAxis()[axis] ;
+				m_data[(6+axis)*Width+i] = triangle->vAxis()[axis] ;
+			}
+			m_triangles[i] = triangle ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	BoundingBox TrianglePack::update()
+		///
+		/// \brief	Reloads the stored triangles after their vertices have been moved (see TriangleBVH::refit)
+		/// 		and computes the box bounding them.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \return	The bounding box of the triangles of the pack.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		BoundingBox update()
+		{
+			BoundingBox box ;
+			for(int cpt=0 ; cpt<Width && m_triangles[cpt]!=NULL ; ++cpt)
+			{
+				set(cpt, m_triangles[cpt]) ;
+				box.update(BoundingBox(*m_triangles[cpt])) ;
+			}
+			return box ;
+		}
+
+		/// \brief	The triangle of slot i (NULL if unused).
+		const Triangle * triangle(int i) const
+		{ return m_triangles[i] ; }
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	bool TrianglePack::intersect(Ray const & ray, float & tMax, int & index, float & u,
+		/// 	float & v) const
+		///
+		/// \brief	Computes the nearest intersection between the ray and the triangles of the pack that
+		/// 		is closer than tMax.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	ray					The ray.
+		/// \param [in,out]	tMax	The upper bound of the tested interval, replaced by the distance
+		/// 						of the intersection if one is found.
+		/// \param [out]	index	The slot of the intersected triangle.
+		/// \param [out]	u		The u coordinate of the intersection.
+		/// \param [out]	v		The v coordinate of the intersection.
+		///
+		/// \return	true if an intersection has been found.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		bool intersect(Ray const & ray, float & tMax, int & index, float & u, float & v) const
+		{
+			_declspec(align(32)) float t[Width] ;
+			_declspec(align(32)) float uu[Width] ;
+			_declspec(align(32)) float vv[Width] ;
+			int mask = TrianglePackTest<Width>::intersect(m_data, ray, tMax, t, uu, vv) ;
+			if(mask==0) { return false ; }
+			index = -1 ;
+			for(int cpt=0 ; cpt<Width ; ++cpt)
+			{
+				if((mask & (1<<cpt)) && t[cpt]<tMax)
+				{
+					tMax = t[cpt] ;
+					index = cpt ;
+				}
+			}
+			u = uu[index] ;
+			v = vv[index] ;
+			return true ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	bool TrianglePack::occludes(Ray const & ray, float tMax) const
+		///
+		/// \brief	Tests if any triangle of the pack is intersected by the ray before tMax.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	ray		The ray.
+		/// \param	tMax	The upper bound of the tested interval.
+		///
+		/// \return	true if a triangle is intersected.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		bool occludes(Ray const & ray, float tMax) const
+		{
+			_declspec(align(32)) float t[Width] ;
+			_declspec(align(32)) float u[Width] ;
+			_declspec(align(32)) float v[Width] ;
+			return TrianglePackTest<Width>::intersect(m_data, ray, tMax, t, u, v)!=0 ;
+		}
+	} ;
+
+	/// \brief	The packs used for rendering: 8 wide when AVX is enabled (AVX_OPT), 4 wide otherwise.
+#ifdef AVX_OPT
+	typedef TrianglePack<8> SceneTrianglePack ;
+#else
+	typedef TrianglePack<4> SceneTrianglePack ;
+#endif
+}
+
+#endif
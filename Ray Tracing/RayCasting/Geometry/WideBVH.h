@@ -0,0 +1,525 @@
+#ifndef _Geometry_WideBVH_H
+#define _Geometry_WideBVH_H
+
+#include <Geometry/BVH.h>
+#include <Geometry/BoundingBox.h>
+#include <Geometry/Ray.h>
+#include <System/aligned_allocator.h>
+#include <vector>
+#include <limits>
+
+#ifdef SSE_OPT
+#include <Math/sse/Float4_functions.h>
+#endif
+#ifdef AVX_OPT
+#include <Math/sse/Float8_functions.h>
+#endif
+
+namespace Geometry
+{
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \class	WideBoxTest
+	///
+	/// \brief	Slab test between a ray and Width boxes stored in structure of arrays form: six rows of
+	/// 		Width floats (min x, min y, min z, max x, max y, max z). The generic version is scalar,
+	/// 		the 4 wide (SSE_OPT) and 8 wide (AVX_OPT) versions test all the boxes at once.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	template <int Width>
+	class WideBoxTest
+	{
+	public:
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	static int WideBoxTest::intersect(const float * bounds, Ray const & ray, float tMax,
+		/// 	float * tEntry)
+		///
+		/// \brief	Tests the boxes against the ray in the interval [0;tMax].
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	bounds			The bounds of the boxes (6 rows of Width floats, suitably aligned).
+		/// \param	ray				The ray.
+		/// \param	tMax			The upper bound of the tested interval.
+		/// \param [out]	tEntry	The entry distance of the ray in each box (Width floats, suitably
+		/// 						aligned).
+		///
+		/// \return	A mask whose bit i is set if the ray intersects box i.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		static int intersect(const float * bounds, Ray const & ray, float tMax, float * tEntry)
+		{
+			const int * sign = ray.getSign() ;
+			int mask = 0 ;
+			for(int cpt=0 ; cpt<Width ; ++cpt)
+			{
+				float tNear = 0.0f ;
+				float tFar = tMax ;
+				for(int axis=0 ; axis<3 ; ++axis)
+				{
+					float t0 = (bounds[(sign[axis]*3+axis)*Width+cpt]-ray.source()[axis])*ray.invDirection()[axis] ;
+					float t1 = (bounds[((1-sign[axis])*3+axis)*Width+cpt]-ray.source()[axis])*ray.invDirection()[axis] ;
+					if(t0>tNear) { tNear = t0 ; }
+					if(t1<tFar) { tFar = t1 ; }
+				}
+				tEntry[cpt] = tNear ;
+				if(tNear<=tFar) { mask |= 1<<cpt ; }
+			}
+			return mask ;
+		}
+	} ;
+
+#ifdef SSE_OPT
+	template <>
+	class WideBoxTest<4>
+	{
+	public:
+		static int intersect(const float * bounds, Ray const & ray, float tMax, float * tEntry)
+		{
+			const int * sign = ray.getSign() ;
+			Math::sse::Float4 tNear = makeFloat4(0.0f) ;
+			Math::sse::Float4 tFar = makeFloat4(tMax) ;
+			for(int axis=0 ; axis<3 ; ++axis)
+			{
+				Math::sse::Float4 source = makeFloat4(ray.source()[axis]) ;
+				Math::sse::Float4 invDirection = makeFloat4(ray.invDirection()[axis]) ;
+				tNear = max((loadFloat4(bounds+(sign[axis]*3+axis)*4)-source)*invDirection, tNear) ;
+				tFar = min((loadFloat4(bounds+((1-sign[axis])*3+axis)*4)-source)*invDirection, tFar) ;
+			}
+			store(tEntry, tNear) ;
+			return signMask(simdLessEquals(tNear, tFar)) ;
+		}
+	} ;
+#endif
+
+#ifdef AVX_OPT
+	template <>
+	class WideBoxTest<8>
+	{
+	public:
+		static int intersect(const float * bounds, Ray const & ray, float tMax, float * tEntry)
+		{
+			const int * sign = ray.getSign() ;
+			Math::sse::Float8 tNear = makeFloat8(0.0f) ;
+			Math::sse::Float8 tFar = makeFloat8(tMax) ;
+			for(int axis=0 ; axis<3 ; ++axis)
+			{
+				Math::sse::Float8 source = makeFloat8(ray.source()[axis]) ;
+				Math::sse::Float8 invDirection = makeFloat8(ray.invDirection()[axis]) ;
+				tNear = max((loadFloat8(bounds+(sign[axis]*3+axis)*8)-source)*invDirection, tNear) ;
+				tFar = min((loadFloat8(bounds+((1-sign[axis])*3+axis)*8)-source)*invDirection, tFar) ;
+			}
+			store(tEntry, tNear) ;
+			return signMask(simdLessEquals(tNear, tFar)) ;
+		}
+	} ;
+#endif
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \class	WideBVH
+	///
+	/// \brief	A bounding volume hierarchy whose nodes have up to Width children. It is obtained by
+	/// 		collapsing a binary BVH: each node stores the boxes of its children in structure of arrays
+	/// 		form so that they are tested against a ray at once (see WideBoxTest). This halves (4 wide)
+	/// 		or thirds (8 wide) the number of traversal steps and of node fetches.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	template <int Width>
+	class WideBVH
+	{
+	public:
+		/// \brief	Alignment of the nodes (required by the SIMD loads of the child boxes).
+		static const int s_alignment = Width*4 ;
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \class	Node
+		///
+		/// \brief	A node of the hierarchy. Child i is either an inner node (count(i)==0), a leaf
+		/// 		referencing count(i) primitives, or an empty slot (its box is empty and is never hit).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		class Node
+		{
+		protected:
+			/// \brief	The child boxes: min x, min y, min z, max x, max y, max z rows.
+			float m_bounds[6*Width] ;
+			/// \brief	Index of the child node (inner child) or of the first primitive (leaf child).
+			int m_child[Width] ;
+			/// \brief	Number of primitives of the leaf children (0 for inner children and empty slots).
+			int m_count[Width] ;
+
+		public:
+			Node()
+			{
+				for(int cpt=0 ; cpt<Width ; ++cpt)
+				{
+					setChild(cpt, BoundingBox(), -1, 0) ;
+				}
+			}
+
+			/// \brief	Sets the box, the index and the primitive count of a child.
+			void setChild(int i, BoundingBox const & box, int index, int count)
+			{
+				for(int axis=0 ; axis<3 ; ++axis)
+				{
+					m_bounds[axis*Width+i] = box.minVertex()[axis] ;
+					m_bounds[(3+axis)*Width+i] = box.maxVertex()[axis] ;
+				}
+				m_child[i] = index ;
+				m_count[i] = count ;
+			}
+
+			/// \brief	The child boxes in structure of arrays form.
+			const float * bounds() const
+			{ return m_bounds ; }
+
+			/// \brief	The box of a child.
+			BoundingBox box(int i) const
+			{
+				return BoundingBox(Math::Vector3(m_bounds[i], m_bounds[Width+i], m_bounds[2*Width+i]),
+								   Math::Vector3(m_bounds[3*Width+i], m_bounds[4*Width+i], m_bounds[5*Width+i])) ;
+			}
+
+			/// \brief	The box bounding all the children (empty slots have an empty box).
+			BoundingBox box() const
+			{
+				BoundingBox result ;
+				for(int cpt=0 ; cpt<Width ; ++cpt)
+				{
+					result.update(box(cpt)) ;
+				}
+				return result ;
+			}
+
+			/// \brief	Sets the box of a child.
+			void setBox(int i, BoundingBox const & box)
+			{
+				setChild(i, box, m_child[i], m_count[i]) ;
+			}
+
+			/// \brief	Is child i a leaf?
+			bool isLeaf(int i) const
+			{ return m_count[i]!=0 ; }
+
+			/// \brief	Index of child i (node index of an inner child, first primitive of a leaf child).
+			int child(int i) const
+			{ return m_child[i] ; }
+
+			/// \brief	Number of primitives of a leaf child.
+			int primitiveCount(int i) const
+			{ return m_count[i] ; }
+		} ;
+
+	protected:
+		/// \brief	Size of the traversal stack (each level pushes at most Width-1 entries).
+		static const int s_stackSize = 64*(Width-1)+1 ;
+
+		/// \brief	The nodes (the root is the first one).
+		::std::vector<Node, aligned_allocator<Node, s_alignment> > m_nodes ;
+		/// \brief	Primitive indices referenced by the leaves.
+		::std::vector<int> m_primitives ;
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	int WideBVH::collapse(BVH const & bvh, int binaryNode)
+		///
+		/// \brief	Creates the node gathering the children of an inner node of the binary hierarchy: the
+		/// 		inner child with the largest surface is replaced by its own children until Width
+		/// 		children are gathered.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	bvh		  	The binary hierarchy.
+		/// \param	binaryNode	Index of the inner node in the binary hierarchy.
+		///
+		/// \return	The index of the created node.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		int collapse(BVH const & bvh, int binaryNode)
+		{
+			const ::std::vector<BVH::Node, aligned_allocator<BVH::Node, 16> > & binaryNodes = bvh.nodes() ;
+			int nodeIndex = (int)m_nodes.size() ;
+			m_nodes.push_back(Node()) ;
+
+			int children[Width] ;
+			int childCount = 2 ;
+			children[0] = binaryNode+1 ;
+			children[1] = binaryNodes[binaryNode].rightChild() ;
+			while(childCount<Width)
+			{
+				int best = -1 ;
+				float bestSurface = -1.0f ;
+				for(int cpt=0 ; cpt<childCount ; ++cpt)
+				{
+					const BVH::Node & child = binaryNodes[children[cpt]] ;
+					if(!child.isLeaf() && child.box().surface()>bestSurface)
+					{
+						best = cpt ;
+						bestSurface = child.box().surface() ;
+					}
+				}
+				if(best==-1) { break ; }
+				int opened = children[best] ;
+				children[best] = opened+1 ;
+				children[childCount++] = binaryNodes[opened].rightChild() ;
+			}
+
+			Node node ;
+			for(int cpt=0 ; cpt<childCount ; ++cpt)
+			{
+				const BVH::Node & child = binaryNodes[children[cpt]] ;
+				if(child.isLeaf())
+				{
+					node.setChild(cpt, child.box(), child.firstPrimitive(), child.primitiveCount()) ;
+				}
+				else
+				{
+					node.setChild(cpt, child.box(), collapse(bvh, children[cpt]), 0) ;
+				}
+			}
+			m_nodes[nodeIndex] = node ;
+			return nodeIndex ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \class	StackEntry
+		///
+		/// \brief	An entry of the traversal stack: a child (node or leaf) and the distance at which the
+		/// 		ray enters its box.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		struct StackEntry
+		{
+			int m_index ;
+			int m_count ;
+			float m_tEntry ;
+		} ;
+
+	public:
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	WideBVH::WideBVH()
+		///
+		/// \brief	Default constructor (empty hierarchy).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		WideBVH()
+		{}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void WideBVH::build(BVH const & bvh)
+		///
+		/// \brief	Builds the hierarchy by collapsing the provided binary hierarchy. The primitive indices
+		/// 		are the ones of the binary hierarchy.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	bvh	The binary hierarchy.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void build(BVH const & bvh)
+		{
+			m_nodes.clear() ;
+			m_primitives = bvh.primitives() ;
+			if(bvh.nodes().empty()) { return ; }
+
+			m_nodes.reserve(bvh.nodes().size()/2+1) ;
+			const BVH::Node & root = bvh.nodes()[0] ;
+			if(root.isLeaf())
+			{
+				m_nodes.push_back(Node()) ;
+				m_nodes[0].setChild(0, root.box(), root.firstPrimitive(), root.primitiveCount()) ;
+			}
+			else
+			{
+				collapse(bvh, 0) ;
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void WideBVH::build(::std::vector<BoundingBox, aligned_allocator<BoundingBox, 16> > const & boxes)
+		///
+		/// \brief	Builds the hierarchy over the primitives described by the provided bounding boxes (see
+		/// 		BVH::build).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	boxes	The bounding boxes of the primitives.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void build(::std::vector<BoundingBox, aligned_allocator<BoundingBox, 16> > const & boxes)
+		{
+			BVH bvh ;
+			bvh.build(boxes) ;
+			build(bvh) ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void WideBVH::refit(::std::vector<BoundingBox, aligned_allocator<BoundingBox, 16> > const & boxes)
+		///
+		/// \brief	Updates the boxes of the nodes after the primitives have moved, the structure of the
+		/// 		hierarchy being kept. Nodes are processed bottom-up (a child node is always stored after
+		/// 		its parent). The quality of the hierarchy decreases with the motion of the primitives,
+		/// 		see WideBVH::sahCost.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	boxes	The new bounding boxes of the primitives (same indexing as for the build).
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void refit(::std::vector<BoundingBox, aligned_allocator<BoundingBox, 16> > const & boxes)
+		{
+			for(int index=(int)m_nodes.size()-1 ; index>=0 ; --index)
+			{
+				Node & node = m_nodes[index] ;
+				for(int cpt=0 ; cpt<Width ; ++cpt)
+				{
+					if(node.child(cpt)==-1) { continue ; }
+					BoundingBox box ;
+					if(node.isLeaf(cpt))
+					{
+						for(int primitive=node.child(cpt), end=primitive+node.primitiveCount(cpt) ; primitive<end ; ++primitive)
+						{
+							box.update(boxes[m_primitives[primitive]]) ;
+						}
+					}
+					else
+					{
+						box = m_nodes[node.child(cpt)].box() ;
+					}
+					node.setBox(cpt, box) ;
+				}
+			}
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	float WideBVH::sahCost() const
+		///
+		/// \brief	Computes the cost of the hierarchy according to the surface area heuristic (see
+		/// 		BVH::sahCost). Used to detect when refitting has degraded the hierarchy too much.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \return	The cost (0 for an empty hierarchy).
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		float sahCost() const
+		{
+			if(m_nodes.empty()) { return 0.0f ; }
+			float rootSurface = m_nodes[0].box().surface() ;
+			if(rootSurface<=0.0f) { return (float)m_primitives.size() ; }
+			float cost = 0.0f ;
+			for(int index=0 ; index<(int)m_nodes.size() ; ++index)
+			{
+				const Node & node = m_nodes[index] ;
+				cost += node.box().surface()/rootSurface * BVH::traversalCost() ;
+				for(int cpt=0 ; cpt<Width ; ++cpt)
+				{
+					if(node.isLeaf(cpt))
+					{
+						cost += node.box(cpt).surface()/rootSurface * (float)node.primitiveCount(cpt) ;
+					}
+				}
+			}
+			return cost ;
+		}
+
+		/// \brief	The nodes of the hierarchy, the root being the first one.
+		const ::std::vector<Node, aligned_allocator<Node, s_alignment> > & nodes() const
+		{ return m_nodes ; }
+
+		/// \brief	The primitive indices referenced by the leaves.
+		const ::std::vector<int> & primitives() const
+		{ return m_primitives ; }
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	template <class PrimitiveIntersector> bool WideBVH::traverse(Ray const & ray, float & tMax,
+		/// 	PrimitiveIntersector & intersector) const
+		///
+		/// \brief	Traverses the hierarchy with the provided ray. The children of a node are tested at
+		/// 		once, the hit ones are visited front to back and nodes farther than tMax are skipped.
+		///
+		/// 		The intersector is called as intersector(primitive, tMax) for each primitive of the
+		/// 		visited leaves. It should reduce tMax when it finds a closer intersection and return true
+		/// 		to stop the traversal (any hit queries), false otherwise. The number of visited nodes is
+		/// 		reported to the intersector by its visitNodes method (ray statistics).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	ray						The ray.
+		/// \param [in,out]	tMax			The maximum distance of interest along the ray.
+		/// \param [in,out]	intersector		The primitive intersector.
+		///
+		/// \return	true if the traversal has been stopped by the intersector.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		template <class PrimitiveIntersector>
+		bool traverse(Ray const & ray, float & tMax, PrimitiveIntersector & intersector) const
+		{
+			if(m_nodes.empty()) { return false ; }
+
+			StackEntry stack[s_stackSize] ;
+			int stackSize = 0 ;
+			stack[stackSize].m_index = 0 ;
+			stack[stackSize].m_count = 0 ;
+			stack[stackSize].m_tEntry = 0.0f ;
+			++stackSize ;
+
+			_declspec(align(32)) float tEntry[Width] ;
+			int visited = 0 ;
+			while(stackSize!=0)
+			{
+				const StackEntry entry = stack[--stackSize] ;
+				// The child may have been hidden by a closer intersection found in the meantime
+				if(entry.m_tEntry>=tMax) { continue ; }
+
+				if(entry.m_count!=0)
+				{
+					for(int cpt=entry.m_index, end=cpt+entry.m_count ; cpt<end ; ++cpt)
+					{
+						if(intersector(m_primitives[cpt], tMax)) { intersector.visitNodes(visited) ; return true ; }
+					}
+					continue ;
+				}
+
+				const Node & node = m_nodes[entry.m_index] ;
+				++visited ;
+				int mask = WideBoxTest<Width>::intersect(node.bounds(), ray, tMax, tEntry) ;
+				// Hit children are sorted by decreasing entry distance and pushed so that the nearest one
+				// is on top of the stack
+				int first = stackSize ;
+				for(int cpt=0 ; cpt<Width ; ++cpt)
+				{
+					if((mask & (1<<cpt))==0) { continue ; }
+					int position = stackSize++ ;
+					while(position>first && stack[position-1].m_tEntry<tEntry[cpt])
+					{
+						stack[position] = stack[position-1] ;
+						--position ;
+					}
+					stack[position].m_index = node.child(cpt) ;
+					stack[position].m_count = node.primitiveCount(cpt) ;
+					stack[position].m_tEntry = tEntry[cpt] ;
+				}
+			}
+			intersector.visitNodes(visited) ;
+			return false ;
+		}
+	} ;
+
+	/// \brief	The hierarchy used for rendering: 8 wide when AVX is enabled (AVX_OPT), 4 wide otherwise.
+#ifdef AVX_OPT
+	typedef WideBVH<8> SceneBVH ;
+#else
+	typedef WideBVH<4> SceneBVH ;
+#endif
+}
+
+#endif
@@ -1,3 +1,3 @@
-/** \brief Espace de nommage contenant les classes relatives  la gestion d'une gomtrie */
+/** \brief Espace de nommage contenant les classes relatives à la gestion d'une géométrie */
 namespace Geometry
 {}
\ No newline at end of file
@@ -0,0 +1,142 @@
+#ifndef _Math_AliasTable_H
+#define _Math_AliasTable_H
+
+#include <vector>
+
+namespace Math
+{
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \class	AliasTable
+	///
+	/// \brief	Discrete distribution proportional to a set of weights, sampled in constant time with
+	/// 		the alias method (Vose): each cell of the table stores the probability of keeping its own
+	/// 		index and the index returned otherwise.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	class AliasTable
+	{
+	protected:
+		/// \brief	Probability of keeping the index of the cell.
+		::std::vector<float> m_threshold ;
+		/// \brief	Index returned when the index of the cell is not kept.
+		::std::vector<int> m_alias ;
+		/// \brief	Probability of each index.
+		::std::vector<float> m_probability ;
+		/// \brief	Sum of the weights.
+		float m_total ;
+
+	public:
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	AliasTable::AliasTable()
+		///
+		/// \brief	Default constructor (empty distribution).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		AliasTable()
+			: m_total(0.0f)
+		{}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void AliasTable::build(::std::vector<float> const & weights)
+		///
+		/// \brief	Builds the table from non negative weights. The table is empty if the weights sum to 0.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	weights	The weights.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void build(::std::vector<float> const & weights)
+		{
+			int size = (int)weights.size() ;
+			double total = 0.0 ;
+			for(int cpt=0 ; cpt<size ; ++cpt)
+			{
+				total += weights[cpt] ;
+			}
+			m_total = (float)total ;
+			m_threshold.clear() ;
+			m_alias.clear() ;
+			m_probability.clear() ;
+			if(total<=0.0)
+			{
+				return ;
+			}
+
+			// Scaled weights: an average cell has a weight of 1
+			::std::vector<double> scaled(size) ;
+			::std::vector<int> small, large ;
+			m_probability.resize(size) ;
+			m_threshold.resize(size, 1.0f) ;
+			m_alias.resize(size) ;
+			for(int cpt=0 ; cpt<size ; ++cpt)
+			{
+				m_probability[cpt] = (float)(weights[cpt]/total) ;
+				scaled[cpt] = weights[cpt]*size/total ;
+				m_alias[cpt] = cpt ;
+				(scaled[cpt]<1.0 ? small : large).push_back(cpt) ;
+			}
+			// Each small cell is filled by a large one
+			while(!small.empty() && !large.empty())
+			{
+				int less = small.back() ;
+				small.pop_back() ;
+				int more = large.back() ;
+				m_threshold[less] = (float)scaled[less] ;
+				m_alias[less] = more ;
+				scaled[more] -= 1.0-scaled[less] ;
+				if(scaled[more]<1.0)
+				{
+					large.pop_back() ;
+					small.push_back(more) ;
+				}
+			}
+			// Remaining cells only differ from 1 by rounding errors and keep their own index
+		}
+
+		/// \brief	Tests if the distribution is empty.
+		bool empty() const
+		{ return m_alias.empty() ; }
+
+		/// \brief	Number of indices.
+		int size() const
+		{ return (int)m_alias.size() ; }
+
+		/// \brief	Sum of the weights the table was built from.
+		float total() const
+		{ return m_total ; }
+
+		/// \brief	Probability of sampling an index (its weight divided by the sum of the weights).
+		float probability(int index) const
+		{ return m_probability[index] ; }
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	int AliasTable::sample(float u1, float u2) const
+		///
+		/// \brief	Samples an index. The table must not be empty.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	u1	Uniform value in [0;1[ selecting the cell.
+		/// \param	u2	Uniform value in [0;1[ selecting the cell index or its alias.
+		///
+		/// \return	The index.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		int sample(float u1, float u2) const
+		{
+			int cell = (int)(u1*m_alias.size()) ;
+			if(cell>=(int)m_alias.size())
+			{
+				cell = (int)m_alias.size()-1 ;
+			}
+			return (u2<m_threshold[cell]) ? cell : m_alias[cell] ;
+		}
+	} ;
+}
+
+#endif
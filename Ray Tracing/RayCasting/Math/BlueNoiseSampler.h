@@ -0,0 +1,184 @@
+#ifndef _Math_BlueNoiseSampler_H
+#define _Math_BlueNoiseSampler_H
+
+#include <Math/SobolSampler.h>
+#include <Math/Random.h>
+#include <vector>
+#include <algorithm>
+#include <math.h>
+
+namespace Math
+{
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \class	BlueNoiseSampler
+	///
+	/// \brief	Scrambled Sobol sampler dithered by a blue noise mask: all the pixels share the same
+	/// 		scrambled sequence, shifted (toroidally, Cranley-Patterson rotation) by the value of a
+	/// 		blue noise mask at the pixel. Each pixel keeps the stratification of the sequence, and the
+	/// 		remaining error of neighbouring pixels is decorrelated with a blue noise spectrum, which is
+	/// 		perceived as less noisy at low sample counts. Each pair of dimensions reads the mask
+	/// 		with a different offset.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	class BlueNoiseSampler : public SobolSampler
+	{
+	protected:
+		/// \brief	Size of the (toroidal) blue noise mask.
+		static const int s_maskSize = 64 ;
+
+		/// \brief	The column of the pixel of the current sample.
+		int m_x ;
+		/// \brief	The row of the pixel of the current sample.
+		int m_y ;
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	static std::vector<float> BlueNoiseSampler::generateMask()
+		///
+		/// \brief	Generates a blue noise mask with the void and cluster method (Ulichney 1993): pixels
+		/// 		are ranked by repeatedly removing the tightest cluster then filling the largest void of
+		/// 		a binary pattern, clusters and voids being found with a gaussian filter on a torus.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \return	The mask (s_maskSize^2 values in [0;1[, row by row).
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		static ::std::vector<float> generateMask()
+		{
+			const int size = s_maskSize ;
+			const int count = size*size ;
+			// Gaussian filter (sigma = 1.5) indexed by the toroidal offset
+			::std::vector<float> filter(count) ;
+			for(int y=0 ; y<size ; ++y)
+			{
+				for(int x=0 ; x<size ; ++x)
+				{
+					int dx = ::std::min(x, size-x), dy = ::std::min(y, size-y) ;
+					filter[y*size+x] = expf(-(float)(dx*dx+dy*dy)/(2.0f*1.5f*1.5f)) ;
+				}
+			}
+			::std::vector<unsigned char> pattern(count, 0) ;
+			::std::vector<float> energy(count, 0.0f) ;
+			auto toggle = [&](int pixel, bool value)
+			{
+				pattern[pixel] = value ;
+				int px = pixel%size, py = pixel/size ;
+				float sign = value ? 1.0f : -1.0f ;
+				for(int y=0 ; y<size ; ++y)
+				{
+					const float * row = &filter[((y-py+size)%size)*size] ;
+					float * target = &energy[y*size] ;
+					for(int x=0 ; x<size ; ++x)
+					{
+						target[x] += sign*row[(x-px+size)%size] ;
+					}
+				}
+			} ;
+			// Tightest cluster (highest energy among the set pixels) or largest void (lowest among the others)
+			auto find = [&](bool cluster) -> int
+			{
+				int result = -1 ;
+				for(int pixel=0 ; pixel<count ; ++pixel)
+				{
+					if((pattern[pixel]!=0)!=cluster) continue ;
+					if(result<0 || (cluster ? energy[pixel]>energy[result] : energy[pixel]<energy[result])) result = pixel ;
+				}
+				return result ;
+			} ;
+
+			// Initial pattern: 10% random pixels, then clusters are moved into voids until stable
+			Random random(0x5eed) ;
+			int ones = count/10 ;
+			for(int cpt=0 ; cpt<ones ; )
+			{
+				int pixel = (int)(random.next()%count) ;
+				if(!pattern[pixel]) { toggle(pixel, true) ; ++cpt ; }
+			}
+			for(;;)
+			{
+				int cluster = find(true) ;
+				toggle(cluster, false) ;
+				int hole = find(false) ;
+				toggle(hole, true) ;
+				if(hole==cluster) break ;
+			}
+			::std::vector<unsigned char> initial(pattern) ;
+			::std::vector<float> initialEnergy(energy) ;
+			::std::vector<int> rank(count) ;
+			// Phase 1: removes the tightest clusters of the initial pattern
+			for(int cpt=ones-1 ; cpt>=0 ; --cpt)
+			{
+				int cluster = find(true) ;
+				toggle(cluster, false) ;
+				rank[cluster] = cpt ;
+			}
+			pattern = initial ;
+			energy = initialEnergy ;
+			// Phase 2 and 3: fills the largest voids (the filter is linear, so this also covers the
+			// second half where the minority pixels are the unset ones)
+			for(int cpt=ones ; cpt<count ; ++cpt)
+			{
+				int hole = find(false) ;
+				toggle(hole, true) ;
+				rank[hole] = cpt ;
+			}
+			::std::vector<float> mask(count) ;
+			for(int pixel=0 ; pixel<count ; ++pixel)
+			{
+				mask[pixel] = ((float)rank[pixel]+0.5f)/(float)count ;
+			}
+			return mask ;
+		}
+
+		/// \brief	The blue noise mask, generated at the first use.
+		static const ::std::vector<float> & mask()
+		{
+			static const ::std::vector<float> result = generateMask() ;
+			return result ;
+		}
+
+		/// \brief	Value of the mask for the current pixel, read with an offset depending on a dimension.
+		float maskValue(uint32_t dimension) const
+		{
+			uint32_t offset = hash(dimension) ;
+			int x = (m_x+(int)(offset & (s_maskSize-1)))&(s_maskSize-1) ;
+			int y = (m_y+(int)((offset>>8) & (s_maskSize-1)))&(s_maskSize-1) ;
+			return mask()[y*s_maskSize+x] ;
+		}
+
+		/// \brief	Seed of a pair of dimensions, shared by all the pixels.
+		virtual uint32_t seed(uint32_t dimension) const
+		{
+			return hash(dimension ^ 0xb5297a4du) ^ hash(m_seed) ;
+		}
+
+	public:
+		BlueNoiseSampler(uint32_t seed = 0)
+			: SobolSampler(seed), m_x(0), m_y(0)
+		{
+			mask() ;
+		}
+
+		virtual void startSample(int x, int y, unsigned int index)
+		{
+			SobolSampler::startSample(x, y, index) ;
+			m_x = x ;
+			m_y = y ;
+		}
+
+		virtual void get2D(float & u, float & v)
+		{
+			uint32_t dimension = m_dimension ;
+			SobolSampler::get2D(u, v) ;
+			// Toroidal shift by the mask
+			u += maskValue(2*dimension) ;
+			v += maskValue(2*dimension+1) ;
+			if(u>=1.0f) u -= 1.0f ;
+			if(v>=1.0f) v -= 1.0f ;
+		}
+	} ;
+}
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef _Math_IndependentSampler_H
+#define _Math_IndependentSampler_H
+
+#include <Math/Sampler.h>
+#include <Math/Random.h>
+
+namespace Math
+{
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \class	IndependentSampler
+	///
+	/// \brief	Reference sampler: all the dimensions are independent uniform values (see
+	/// 		Random::forSample), without any stratification.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	class IndependentSampler : public Sampler
+	{
+	protected:
+		/// \brief	The width of the image (pixel indices are those of Scene::compute).
+		int m_width ;
+		/// \brief	The generator of the current sample.
+		Random m_random ;
+
+	public:
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	IndependentSampler::IndependentSampler(int width, uint32_t seed = 0)
+		///
+		/// \brief	Constructor.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	width	The width of the image.
+		/// \param	seed 	The global seed of the rendering.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		IndependentSampler(int width, uint32_t seed = 0)
+			: Sampler(seed), m_width(width)
+		{}
+
+		virtual void startSample(int x, int y, unsigned int index)
+		{
+			// Even streams: the odd ones are left to the recursive integrator (see Scene::samplePixel)
+			m_random = Random::forSample(y*m_width+x, index, 2*m_seed) ;
+		}
+
+		virtual float get1D()
+		{
+			return m_random.uniform() ;
+		}
+
+		virtual void get2D(float & u, float & v)
+		{
+			u = m_random.uniform() ;
+			v = m_random.uniform() ;
+		}
+	} ;
+}
+
+#endif
@@ -8,7 +8,7 @@ namespace Math
   ///
   /// \brief	Super class of methematical objects.
   ///
-  /// \author	F. Lamarche, Universit de Rennes 1
+  /// \author	F. Lamarche, Université de Rennes 1
   /// \date	03/12/2013
   ////////////////////////////////////////////////////////////////////////////////////////////////////
   class Object 
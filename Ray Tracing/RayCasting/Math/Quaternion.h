@@ -11,7 +11,7 @@ namespace Math
   ///
   /// \brief	A quaternion.
   ///
-  /// \author	F. Lamarche, Universit de Rennes 1
+  /// \author	F. Lamarche, Université de Rennes 1
   /// \date	03/12/2013
   ////////////////////////////////////////////////////////////////////////////////////////////////////
   class Quaternion : public Object
@@ -32,7 +32,7 @@ namespace Math
     /// 		
     /// \warning Initializes nothing.
     ///
-    /// \author	F. Lamarche, Universit de Rennes 1
+    /// \author	F. Lamarche, Université de Rennes 1
     /// \date	03/12/2013
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     Quaternion()
@@ -45,7 +45,7 @@ namespace Math
     ///
     /// \brief	Constructor with rotation axis and angle.
     ///
-    /// \author	F. Lamarche, Universit de Rennes 1
+    /// \author	F. Lamarche, Université de Rennes 1
     /// \date	03/12/2013
     ///
     /// \param	v	 	The rotation axis.
@@ -60,7 +60,7 @@ namespace Math
     ///
     /// \brief	Constructor from a point.
     ///
-    /// \author	F. Lamarche, Universit de Rennes 1
+    /// \author	F. Lamarche, Université de Rennes 1
     /// \date	03/12/2013
     ///
     /// \param	v	The point
@@ -74,7 +74,7 @@ namespace Math
     ///
     /// \brief	Copy constructor.
     ///
-    /// \author	F. Lamarche, Universit de Rennes 1
+    /// \author	F. Lamarche, Université de Rennes 1
     /// \date	03/12/2013
     ///
     /// \param	q	The Quaternion const &amp; to process.
@@ -88,7 +88,7 @@ namespace Math
     ///
     /// \brief	Constructor with quaternion representation.
     ///
-    /// \author	F. Lamarche, Universit de Rennes 1
+    /// \author	F. Lamarche, Université de Rennes 1
     /// \date	03/12/2013
     ///
     /// \param	s	
@@ -103,7 +103,7 @@ namespace Math
     ///
     /// \brief	Gets the rotation angle.
     ///
-    /// \author	F. Lamarche, Universit de Rennes 1
+    /// \author	F. Lamarche, Université de Rennes 1
     /// \date	03/12/2013
     ///
     /// \return	The angle.
@@ -116,7 +116,7 @@ namespace Math
     ///
     /// \brief	Gets the rotation axis.
     ///
-    /// \author	F. Lamarche, Universit de Rennes 1
+    /// \author	F. Lamarche, Université de Rennes 1
     /// \date	03/12/2013
     ///
     /// \return	The axis.
@@ -129,7 +129,7 @@ namespace Math
     ///
     /// \brief	Sets the quaternion from an axis and an angle.
     ///
-    /// \author	F. Lamarche, Universit de Rennes 1
+    /// \author	F. Lamarche, Université de Rennes 1
     /// \date	03/12/2013
     ///
     /// \param	v	 	The rotation axis.
@@ -160,7 +160,7 @@ namespace Math
     ///
     /// \brief	Addition operator.
     ///
-    /// \author	F. Lamarche, Universit de Rennes 1
+    /// \author	F. Lamarche, Université de Rennes 1
     /// \date	03/12/2013
     ///
     /// \param	q	The other quaternion 
@@ -175,7 +175,7 @@ namespace Math
     ///
     /// \brief	Soustraction operator.
     ///
-    /// \author	F. Lamarche, Universit de Rennes 1
+    /// \author	F. Lamarche, Université de Rennes 1
     /// \date	03/12/2013
     ///
     /// \param	q	The other quaternion.
@@ -190,7 +190,7 @@ namespace Math
     ///
     /// \brief	Multiplication operator.
     ///
-    /// \author	F. Lamarche, Universit de Rennes 1
+    /// \author	F. Lamarche, Université de Rennes 1
     /// \date	03/12/2013
     ///
     /// \param	q	The other quaternion.
@@ -207,7 +207,7 @@ namespace Math
     ///
     /// \brief	Multiplication operator.
     ///
-    /// \author	F. Lamarche, Universit de Rennes 1
+    /// \author	F. Lamarche, Université de Rennes 1
     /// \date	03/12/2013
     ///
     /// \param	v	The scalar.
@@ -222,7 +222,7 @@ namespace Math
     ///
     /// \brief	Division operator.
     ///
-    /// \author	F. Lamarche, Universit de Rennes 1
+    /// \author	F. Lamarche, Université de Rennes 1
     /// \date	03/12/2013
     ///
     /// \param	v	The scalar.
@@ -237,7 +237,7 @@ namespace Math
     ///
     /// \brief	Negation operator.
     ///
-    /// \author	F. Lamarche, Universit de Rennes 1
+    /// \author	F. Lamarche, Université de Rennes 1
     /// \date	03/12/2013
     ///
     /// \return	The result of the operation.
@@ -250,7 +250,7 @@ namespace Math
     ///
     /// \brief	Gets the inverse of the quaternion.
     ///
-    /// \author	F. Lamarche, Universit de Rennes 1
+    /// \author	F. Lamarche, Université de Rennes 1
     /// \date	03/12/2013
     ///
     /// \return	.
@@ -263,7 +263,7 @@ namespace Math
     ///
     /// \brief	Gets the square of the quaternion norm.
     ///
-    /// \author	F. Lamarche, Universit de Rennes 1
+    /// \author	F. Lamarche, Université de Rennes 1
     /// \date	03/12/2013
     ///
     /// \return	.
@@ -276,7 +276,7 @@ namespace Math
     ///
     /// \brief	Gets the norm of the quaternion.
     ///
-    /// \author	F. Lamarche, Universit de Rennes 1
+    /// \author	F. Lamarche, Université de Rennes 1
     /// \date	03/12/2013
     ///
     /// \return	.
@@ -289,7 +289,7 @@ namespace Math
     ///
     /// \brief	Assignment operator.
     ///
-    /// \author	F. Lamarche, Universit de Rennes 1
+    /// \author	F. Lamarche, Université de Rennes 1
     /// \date	03/12/2013
     ///
     /// \param	q	The other quaternion.
@@ -308,7 +308,7 @@ namespace Math
     ///
     /// \brief	Normalizes this quaternion.
     ///
-    /// \author	F. Lamarche, Universit de Rennes 1
+    /// \author	F. Lamarche, Université de Rennes 1
     /// \date	03/12/2013
     ///
     /// \return	.
@@ -324,7 +324,7 @@ namespace Math
     ///
     /// \brief	Rotates the given quaternion.
     ///
-    /// \author	F. Lamarche, Universit de Rennes 1
+    /// \author	F. Lamarche, Université de Rennes 1
     /// \date	03/12/2013
     ///
     /// \param	q	The Quaternion const &amp; to process.
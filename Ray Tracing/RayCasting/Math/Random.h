@@ -0,0 +1,114 @@
+#ifndef _Math_Random_H
+#define _Math_Random_H
+
+#include <stdint.h>
+
+namespace Math
+{
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \class	Random
+	///
+	/// \brief	PCG32 pseudo random number generator (64 bits state, XSH RR output). Unlike rand(), it has
+	/// 		no shared state: each pixel sample owns its generator, which is passed to the functions
+	/// 		that need random numbers. The sequence of a pixel sample only depends on its seed, so
+	/// 		renderings do not depend on the number of threads nor on the order in which pixels are
+	/// 		computed.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	class Random
+	{
+	protected:
+		/// \brief	The state.
+		uint64_t m_state ;
+		/// \brief	The increment (selects the stream, must be odd).
+		uint64_t m_increment ;
+
+		/// \brief	SplitMix64 finalizer, used to decorrelate close seeds.
+		static uint64_t mix(uint64_t value)
+		{
+			value += 0x9E3779B97F4A7C15ull ;
+			value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull ;
+			value = (value ^ (value >> 27)) * 0x94D049BB133111EBull ;
+			return value ^ (value >> 31) ;
+		}
+
+	public:
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	Random::Random(uint64_t seed, uint64_t stream)
+		///
+		/// \brief	Constructor.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	seed  	The seed (starting point in the stream).
+		/// \param	stream	The stream (two streams never overlap).
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		Random(uint64_t seed = 0, uint64_t stream = 0)
+			: m_state(0), m_increment((stream << 1) | 1)
+		{
+			next() ;
+			m_state += seed ;
+			next() ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	static Random Random::forSample(unsigned int pixel, unsigned int sample, unsigned int seed)
+		///
+		/// \brief	Creates the generator of a pixel sample: its sequence depends on the pixel, the sample
+		/// 		index and a global seed only.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	pixel 	Index of the pixel.
+		/// \param	sample	Index of the sample in the pixel.
+		/// \param	seed  	Global seed of the rendering.
+		///
+		/// \return	The generator.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		static Random forSample(unsigned int pixel, unsigned int sample, unsigned int seed = 0)
+		{
+			uint64_t key = mix(((uint64_t)pixel << 32) | sample) ^ mix((uint64_t)seed) ;
+			return Random(key, mix(key)) ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	uint32_t Random::next()
+		///
+		/// \brief	Generates a 32 bits random integer.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \return	The random integer.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		uint32_t next()
+		{
+			uint64_t old = m_state ;
+			m_state = old*6364136223846793005ull + m_increment ;
+			uint32_t shifted = (uint32_t)(((old >> 18) ^ old) >> 27) ;
+			uint32_t rotation = (uint32_t)(old >> 59) ;
+			return (shifted >> rotation) | (shifted << ((32-rotation) & 31)) ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	float Random::uniform()
+		///
+		/// \brief	Generates a random value in [0;1[.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \return	The random value.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		float uniform()
+		{
+			return (float)(next() >> 8) * (1.0f/16777216.0f) ;
+		}
+	} ;
+}
+
+#endif
@@ -2,7 +2,12 @@
 #define _Math_RandomDirection_H
 
 #include <math.h>
-#include <stdlib.h>
+#include <Math/Vector3.h>
+#include <Math/Random.h>
+
+#ifndef M_PI
+#define M_PI 3.1415926535897932384626433832795
+#endif
 
 namespace Math
 {
@@ -11,134 +16,200 @@ namespace Math
 	///
 	/// \brief	Random direction sampling. the sampling is biased by a cosine distribution, useful for
 	/// 		respecting a BRDF distribution (diffuse or specular).
-	/// 		
+	///
+	/// 		An orthonormal basis around the main direction is computed once by the constructor, each
+	/// 		sample then costs one sqrt (cosine distribution, Malley's method) or one pow (cos^n
+	/// 		distribution) and one sine / cosine pair.
+	///
 	/// \author	F. Lamarche, University of Rennes 1.
 	/// \date	04/12/2013
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	class RandomDirection
 	{
 	protected:
+		/// \brief	The main direction for sampling (Z axis of the local basis).
+		Math::Vector3 m_direction ;
+
+		/// \brief	First direction normal to the main direction (X axis of the local basis).
+		Math::Vector3 m_tangent ;
+
+		/// \brief	Second direction normal to the main direction (Y axis of the local basis).
+		Math::Vector3 m_bitangent ;
+
+		/// \brief	The specular coefficient.
+		float m_n ;
+
+		/// \brief	Exponent applied to a uniform value to sample cos(theta): 1/(n+1).
+		float m_exponent ;
 
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		/// \fn	static ::std::pair<float,float> RandomDirection::randomPolar(float n=1.0)
+		/// \fn	void RandomDirection::sampleLocal(float u1, float u2, float & x, float & y, float & z) const
 		///
-		/// \brief	Random sampling of spherical coordinates.
+		/// \brief	Maps two uniform values to a direction in the local basis (Z being the main direction).
 		///
-		/// \author	F. Lamarche, University of Rennes 1.
-		/// \date	04/12/2013
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
 		///
-		/// \param	n	(optional) The specular index (1.0 if diffuse).
-		///
-		/// \return	Random spherical coordinates repecting a cos^n distribution.
+		/// \param	u1				Uniform value in [0;1[ selecting cos(theta).
+		/// \param	u2				Uniform value in [0;1[ selecting phi.
+		/// \param [out]	x		The coordinate along m_tangent.
+		/// \param [out]	y		The coordinate along m_bitangent.
+		/// \param [out]	z		The coordinate along m_direction (cos(theta)).
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		static ::std::pair<float,float> randomPolar(float n=1.0)
+		void sampleLocal(float u1, float u2, float & x, float & y, float & z) const
 		{
-			float rand1 = random() ;
-			float p = pow(rand1, 1/(n+1)) ;
-			float theta = acos(p) ;
-			float rand2 = random() ;
-			float phy = 2*M_PI*rand2 ;
-			return ::std::make_pair(theta, phy) ;
+			float rand1 = u1 ;
+			float phy = 2.0f*(float)M_PI*u2 ;
+			float sinTheta ;
+			if(m_n==1.0f)
+			{
+				// Malley's method: uniform point on the unit disk projected on the hemisphere
+				sinTheta = sqrtf(rand1) ;
+				z = sqrtf(1.0f-rand1) ;
+			}
+			else
+			{
+				z = powf(rand1, m_exponent) ;
+				sinTheta = sqrtf(1.0f-z*z) ;
+			}
+			x = sinTheta*cosf(phy) ;
+			y = sinTheta*sinf(phy) ;
 		}
 
+	public:
+
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		/// \fn	static Math::Vector3 RandomDirection::getVector(float theta, float phy)
+		/// \fn	RandomDirection::RandomDirection(Math::Vector3 const & direction, float n=1.0)
+		///
+		/// \brief	Constructor.
 		///
-		/// \brief	Computes the normalized vector corresponding to provided spherical coordinates.
-		/// 		
 		/// \author	F. Lamarche, University of Rennes 1.
 		/// \date	04/12/2013
 		///
-		/// \param	theta	
-		/// \param	phy  	
-		///
-		/// \return	The vector.
+		/// \param	direction	The main direction of the random sampling.
+		/// \param	n		 	n The specular coefficient of the surface (1.0 is diffuse component, the
+		/// 					specular coefficient otherwise)
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		static Math::Vector3 getVector(float theta, float phy)
+		RandomDirection(Math::Vector3 const & direction, float n=1.0)
+			: m_direction(direction.normalized()), m_n(n), m_exponent(1.0f/(n+1.0f))
 		{
-			return Math::Vector3(sin(theta)*cos(phy), sin(theta)*sin(phy), cos(theta)) ;
+			orthonormalBasis(m_direction, m_tangent, m_bitangent) ;
 		}
 
-	public:
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	RandomDirection::RandomDirection(Math::Vector3 const & direction,
+		/// 	Math::Vector3 const & tangent, Math::Vector3 const & bitangent, float n=1.0)
+		///
+		/// \brief	Constructor from an already computed orthonormal basis (e.g. Geometry::HitRecord), which
+		/// 		saves the normalization and the basis of the other constructor.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	direction	The main direction of the random sampling (unit vector).
+		/// \param	tangent  	First direction normal to the main direction.
+		/// \param	bitangent	Second direction normal to the main direction.
+		/// \param	n		 	The specular coefficient (1.0 is diffuse component).
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		RandomDirection(Math::Vector3 const & direction, Math::Vector3 const & tangent, Math::Vector3 const & bitangent, float n=1.0)
+			: m_direction(direction), m_tangent(tangent), m_bitangent(bitangent), m_n(n), m_exponent(1.0f/(n+1.0f))
+		{}
 
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		/// \fn	static float RandomDirection::random()
+		/// \fn	static void RandomDirection::orthonormalBasis(Math::Vector3 const & direction,
+		/// 	Math::Vector3 & tangent, Math::Vector3 & bitangent)
 		///
-		/// \brief	A random value in interval [0;1]
+		/// \brief	Computes two directions completing a unit vector into an orthonormal basis, without
+		/// 		normalization nor branch on the direction (Duff et al. 2017).
 		///
-		/// \author	F. Lamarche, University of Rennes 1.
-		/// \date	04/12/2013
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
 		///
-		/// \return	A random number in [0;1].
+		/// \param	direction		 	The unit vector (Z axis of the basis).
+		/// \param [out]	tangent  	The X axis of the basis.
+		/// \param [out]	bitangent	The Y axis of the basis.
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		static float random()
+		static void orthonormalBasis(Math::Vector3 const & direction, Math::Vector3 & tangent, Math::Vector3 & bitangent)
 		{
-			return (float)rand()/RAND_MAX ;
+			float sign = (direction[2]>=0.0f) ? 1.0f : -1.0f ;
+			float a = -1.0f/(sign+direction[2]) ;
+			float b = direction[0]*direction[1]*a ;
+			tangent = Math::Vector3(1.0f+sign*direction[0]*direction[0]*a, sign*b, -sign*direction[0]) ;
+			bitangent = Math::Vector3(b, sign+direction[1]*direction[1]*a, -direction[1]) ;
 		}
 
-	protected:
-
-		/// \brief	The main direction for sampling.
-		Math::Vector3 m_direction ;
-
-		/// \brief	A direction normal to the direction vector.
-		Math::Vector3 m_directionNormal ;
-
-		/// \brief	The specular coefficient.
-		float m_n ;
-
-	public:
-
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		/// \fn	RandomDirection::RandomDirection(Math::Vector3 const & direction, float n=1.0)
+		/// \fn	Math::Vector3 RandomDirection::generate(Random & random) const
 		///
-		/// \brief	Constructor.
+		/// \brief	Generate a random direction respecting a cosine^n distribution.
 		///
 		/// \author	F. Lamarche, University of Rennes 1.
 		/// \date	04/12/2013
 		///
-		/// \param	direction	The main direction of the random sampling.
-		/// \param	n		 	n The specular coefficient of the surface (1.0 is diffuse component, the 
-		/// 					specular coefficient otherwise)
+		/// \param [in,out]	random	The random number generator (see Random::forSample).
+		///
+		/// \return	The random direction.
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		RandomDirection(Math::Vector3 const & direction, float n=1.0)
-			: m_direction(direction.normalized()), m_n(n)
+		Math::Vector3 generate(Random & random) const
 		{
-			// We compute a vector normal to the main direction
-			m_directionNormal = Math::Vector3(1.0,0.0,0.0) ;
-			m_directionNormal = m_directionNormal - m_direction*(m_direction*m_directionNormal) ;
-			if(m_directionNormal.norm()<std::numeric_limits<float>::epsilon()*10.0)
-			{
-				m_directionNormal = Math::Vector3(0.0,1.0,0.0) ;
-				m_directionNormal =  m_directionNormal - m_direction*(m_direction*m_directionNormal) ;
-				if(m_directionNormal.norm()<std::numeric_limits<float>::epsilon()*10.0)
-				{
-					m_directionNormal = Math::Vector3(0.0,0.0,1.0) ;
-					m_directionNormal =  m_directionNormal - m_direction*(m_direction*m_directionNormal) ;
-
-				}	
-			}
+			float u1 = random.uniform() ;
+			float u2 = random.uniform() ;
+			return generate(u1, u2) ;
 		}
 
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		/// \fn	Math::Vector3 RandomDirection::generate() const
+		/// \fn	Math::Vector3 RandomDirection::generate(float u1, float u2) const
 		///
-		/// \brief	Generate a random direction respecting a cosine^n distribution.
+		/// \brief	Maps two uniform values (e.g. given by a Math::Sampler) to a direction respecting a
+		/// 		cosine^n distribution.
 		///
-		/// \author	F. Lamarche, University of Rennes 1.
-		/// \date	04/12/2013
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
 		///
-		/// \return	The random direction.
+		/// \param	u1	Uniform value in [0;1[.
+		/// \param	u2	Uniform value in [0;1[.
+		///
+		/// \return	The direction.
 		////////////////////////////////////////////////////////////////////////////////////////////////////
-		Math::Vector3 generate() const
+		Math::Vector3 generate(float u1, float u2) const
 		{
-			::std::pair<float,float> perturbation = randomPolar(m_n) ;
-			Quaternion q1(m_directionNormal, perturbation.first) ;
-			Quaternion q2(m_direction, perturbation.second) ;
-			Math::Quaternion result = q2.rotate(q1.rotate(m_direction)) ;
-			return result.v() ;
+			float x, y, z ;
+			sampleLocal(u1, u2, x, y, z) ;
+			return m_tangent*x + m_bitangent*y + m_direction*z ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void RandomDirection::generate(Random & random, int count, float * x, float * y,
+		/// 	float * z) const
+		///
+		/// \brief	Generates count random directions (see generate) in structure of arrays form.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param [in,out]	random	The random number generator.
+		/// \param	count			The number of directions.
+		/// \param [out]	x		The X coordinates of the directions (count values).
+		/// \param [out]	y		The Y coordinates of the directions (count values).
+		/// \param [out]	z		The Z coordinates of the directions (count values).
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void generate(Random & random, int count, float * x, float * y, float * z) const
+		{
+			const float tx = m_tangent[0], ty = m_tangent[1], tz = m_tangent[2] ;
+			const float bx = m_bitangent[0], by = m_bitangent[1], bz = m_bitangent[2] ;
+			const float dx = m_direction[0], dy = m_direction[1], dz = m_direction[2] ;
+			for(int cpt=0 ; cpt<count ; ++cpt)
+			{
+				float u1 = random.uniform() ;
+				float u2 = random.uniform() ;
+				float u, v, w ;
+				sampleLocal(u1, u2, u, v, w) ;
+				x[cpt] = tx*u + bx*v + dx*w ;
+				y[cpt] = ty*u + by*v + dy*w ;
+				z[cpt] = tz*u + bz*v + dz*w ;
+			}
 		}
 	};
 }
 
-#endif
\ No newline at end of file
+#endif
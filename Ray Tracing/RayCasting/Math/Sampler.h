@@ -0,0 +1,83 @@
+#ifndef _Math_Sampler_H
+#define _Math_Sampler_H
+
+#include <stdint.h>
+
+namespace Math
+{
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \class	Sampler
+	///
+	/// \brief	Generates the uniform values of the samples of a pixel. Each sample is a point of a high
+	/// 		dimensional unit cube: its dimensions are handed out in order (pixel jitter, then light
+	/// 		selection, BRDF sampling... for each bounce), so that implementations can stratify the
+	/// 		samples of a pixel dimension by dimension.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	class Sampler
+	{
+	protected:
+		/// \brief	Global seed of the rendering: the same seed gives the same samples.
+		uint32_t m_seed ;
+
+		/// \brief	Integer hash with a good avalanche (lowbias32), used to derive seeds.
+		static uint32_t hash(uint32_t value)
+		{
+			value ^= value >> 16 ;
+			value *= 0x7feb352du ;
+			value ^= value >> 15 ;
+			value *= 0x846ca68bu ;
+			value ^= value >> 16 ;
+			return value ;
+		}
+
+		/// \brief	Converts 32 random bits in a value in [0;1[ (24 bits of precision).
+		static float toFloat(uint32_t value)
+		{
+			return (float)(value >> 8) * (1.0f/16777216.0f) ;
+		}
+
+	public:
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	Sampler::Sampler(uint32_t seed = 0)
+		///
+		/// \brief	Constructor.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	seed	The global seed of the rendering (see Scene::setSeed).
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		Sampler(uint32_t seed = 0)
+			: m_seed(seed)
+		{}
+
+		virtual ~Sampler()
+		{}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	virtual void Sampler::startSample(int x, int y, unsigned int index) = 0
+		///
+		/// \brief	Starts a new sample: the following calls return its dimensions, starting from the
+		/// 		first one.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	x	 	The column of the pixel.
+		/// \param	y	 	The row of the pixel.
+		/// \param	index	The index of the sample in the pixel.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		virtual void startSample(int x, int y, unsigned int index) = 0 ;
+
+		/// \brief	Gets the next dimension of the current sample, in [0;1[.
+		virtual float get1D() = 0 ;
+
+		/// \brief	Gets the next two dimensions of the current sample, in [0;1[ (stratified together).
+		virtual void get2D(float & u, float & v) = 0 ;
+	} ;
+}
+
+#endif
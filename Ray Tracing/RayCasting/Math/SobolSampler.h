@@ -0,0 +1,121 @@
+#ifndef _Math_SobolSampler_H
+#define _Math_SobolSampler_H
+
+#include <Math/Sampler.h>
+
+namespace Math
+{
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \class	SobolSampler
+	///
+	/// \brief	Owen scrambled Sobol sampler (Burley, Practical Hash-based Owen Scrambling, 2020). Each
+	/// 		pair of dimensions uses the first two dimensions of the Sobol sequence, scrambled with
+	/// 		seeds depending on the pixel and on the pair; the sample indices are shuffled too, so that
+	/// 		pairs are decorrelated. The samples of a pixel are stratified in every pair of dimensions
+	/// 		and converge faster than independent samples, best with power of two sample counts.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	class SobolSampler : public Sampler
+	{
+	protected:
+		/// \brief	Seed of the pixel of the current sample.
+		uint32_t m_pixelSeed ;
+		/// \brief	Index of the current sample in its pixel.
+		uint32_t m_index ;
+		/// \brief	Next pair of dimensions of the current sample.
+		uint32_t m_dimension ;
+
+		/// \brief	Reverses the order of the bits.
+		static uint32_t reverseBits(uint32_t value)
+		{
+			value = ((value >> 1) & 0x55555555u) | ((value & 0x55555555u) << 1) ;
+			value = ((value >> 2) & 0x33333333u) | ((value & 0x33333333u) << 2) ;
+			value = ((value >> 4) & 0x0F0F0F0Fu) | ((value & 0x0F0F0F0Fu) << 4) ;
+			value = ((value >> 8) & 0x00FF00FFu) | ((value & 0x00FF00FFu) << 8) ;
+			return (value >> 16) | (value << 16) ;
+		}
+
+		/// \brief	Owen scrambling of a value whose bits are stored from the most significant one.
+		static uint32_t scramble(uint32_t value, uint32_t seed)
+		{
+			// Laine-Karras permutation on the reversed bits
+			value = reverseBits(value) ;
+			value += seed ;
+			value ^= value * 0x6c50b47cu ;
+			value ^= value * 0xb82f1e52u ;
+			value ^= value * 0xc7afe638u ;
+			value ^= value * 0x8d22f6e6u ;
+			return reverseBits(value) ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	static void SobolSampler::sobol2D(uint32_t index, uint32_t seed, uint32_t & x, uint32_t & y)
+		///
+		/// \brief	Computes the scrambled point of a 2D Sobol sequence.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	index 	The index of the point.
+		/// \param	seed  	The seed of the scrambling.
+		/// \param [out]	x	The first coordinate (32 bits fixed point).
+		/// \param [out]	y	The second coordinate (32 bits fixed point).
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		static void sobol2D(uint32_t index, uint32_t seed, uint32_t & x, uint32_t & y)
+		{
+			// The shuffled index keeps the stratification of the whole sequence
+			index = scramble(index, hash(seed)) ;
+			// First dimension: van der Corput, second dimension: direction numbers v(k) = v(k-1) ^ v(k-1)>>1
+			x = reverseBits(index) ;
+			y = 0 ;
+			uint32_t direction = 0x80000000u ;
+			for( ; index!=0 ; index >>= 1)
+			{
+				if(index & 1)
+				{
+					y ^= direction ;
+				}
+				direction ^= direction >> 1 ;
+			}
+			x = scramble(x, hash(seed ^ 0x9e3779b9u)) ;
+			y = scramble(y, hash(seed ^ 0x7f4a7c15u)) ;
+		}
+
+		/// \brief	Seed of a pair of dimensions of the current sample.
+		virtual uint32_t seed(uint32_t dimension) const
+		{
+			return hash(m_pixelSeed ^ hash(dimension)) ;
+		}
+
+	public:
+		SobolSampler(uint32_t seed = 0)
+			: Sampler(seed), m_pixelSeed(0), m_index(0), m_dimension(0)
+		{}
+
+		virtual void startSample(int x, int y, unsigned int index)
+		{
+			m_pixelSeed = hash(((uint32_t)y << 16) ^ (uint32_t)x) ^ hash(m_seed) ;
+			m_index = index ;
+			m_dimension = 0 ;
+		}
+
+		virtual float get1D()
+		{
+			float u, v ;
+			get2D(u, v) ;
+			return u ;
+		}
+
+		virtual void get2D(float & u, float & v)
+		{
+			uint32_t x, y ;
+			sobol2D(m_index, seed(m_dimension++), x, y) ;
+			u = toFloat(x) ;
+			v = toFloat(y) ;
+		}
+	} ;
+}
+
+#endif
@@ -0,0 +1,157 @@
+#ifndef _Math_Transform_H
+#define _Math_Transform_H
+
+#include <Math/Vector3.h>
+#include <Math/Quaternion.h>
+
+namespace Math
+{
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \class	Transform
+	///
+	/// \brief	An affine transformation stored as a 3x4 matrix: a linear part (3 rows) and a translation.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	class Transform
+	{
+	protected:
+		/// \brief	The rows of the linear part.
+		Vector3 m_rows[3] ;
+		/// \brief	The translation.
+		Vector3 m_translation ;
+
+	public:
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	Transform::Transform()
+		///
+		/// \brief	Default constructor (identity).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		Transform()
+		{
+			m_rows[0] = Vector3(1.0f, 0.0f, 0.0f) ;
+			m_rows[1] = Vector3(0.0f, 1.0f, 0.0f) ;
+			m_rows[2] = Vector3(0.0f, 0.0f, 1.0f) ;
+			m_translation = Vector3(0.0f, 0.0f, 0.0f) ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	Transform::Transform(Vector3 const & xAxis, Vector3 const & yAxis, Vector3 const & zAxis,
+		/// 	Vector3 const & translation)
+		///
+		/// \brief	Constructor from the images of the axes (columns of the linear part) and a translation.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	xAxis	   	The image of the X axis.
+		/// \param	yAxis	   	The image of the Y axis.
+		/// \param	zAxis	   	The image of the Z axis.
+		/// \param	translation	The translation.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		Transform(Vector3 const & xAxis, Vector3 const & yAxis, Vector3 const & zAxis, Vector3 const & translation)
+			: m_translation(translation)
+		{
+			for(int row=0 ; row<3 ; ++row)
+			{
+				m_rows[row] = Vector3(xAxis[row], yAxis[row], zAxis[row]) ;
+			}
+		}
+
+		/// \brief	A translation.
+		static Transform translation(Vector3 const & t)
+		{ return Transform(Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f), t) ; }
+
+		/// \brief	A rotation (see Geometry::Geometry::rotate).
+		static Transform rotation(Quaternion const & q)
+		{
+			return Transform(q.rotate(Vector3(1.0f, 0.0f, 0.0f)).v(), q.rotate(Vector3(0.0f, 1.0f, 0.0f)).v(),
+							 q.rotate(Vector3(0.0f, 0.0f, 1.0f)).v(), Vector3(0.0f, 0.0f, 0.0f)) ;
+		}
+
+		/// \brief	A scale along the X, Y and Z axes.
+		static Transform scaling(Vector3 const & s)
+		{ return Transform(Vector3(s[0], 0.0f, 0.0f), Vector3(0.0f, s[1], 0.0f), Vector3(0.0f, 0.0f, s[2]), Vector3(0.0f, 0.0f, 0.0f)) ; }
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	Vector3 Transform::transformPoint(Vector3 const & p) const
+		///
+		/// \brief	Applies the transformation to a point.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	p	The point.
+		///
+		/// \return	The transformed point.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		Vector3 transformPoint(Vector3 const & p) const
+		{ return transformVector(p)+m_translation ; }
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	Vector3 Transform::transformVector(Vector3 const & v) const
+		///
+		/// \brief	Applies the linear part of the transformation to a vector (directions, edges).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	v	The vector.
+		///
+		/// \return	The transformed vector.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		Vector3 transformVector(Vector3 const & v) const
+		{ return Vector3(m_rows[0]*v, m_rows[1]*v, m_rows[2]*v) ; }
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	Transform Transform::operator* (Transform const & t) const
+		///
+		/// \brief	Composition: the returned transformation applies t, then this transformation.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	t	The transformation applied first.
+		///
+		/// \return	The composed transformation.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		Transform operator* (Transform const & t) const
+		{
+			return Transform(transformVector(Vector3(t.m_rows[0][0], t.m_rows[1][0], t.m_rows[2][0])),
+							 transformVector(Vector3(t.m_rows[0][1], t.m_rows[1][1], t.m_rows[2][1])),
+							 transformVector(Vector3(t.m_rows[0][2], t.m_rows[1][2], t.m_rows[2][2])),
+							 transformPoint(t.m_translation)) ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	Transform Transform::inverse() const
+		///
+		/// \brief	Computes the inverse transformation (the linear part must be invertible).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \return	The inverse transformation.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		Transform inverse() const
+		{
+			// The rows of the inverse are the cross products of the columns divided by the determinant
+			Vector3 x(m_rows[0][0], m_rows[1][0], m_rows[2][0]) ;
+			Vector3 y(m_rows[0][1], m_rows[1][1], m_rows[2][1]) ;
+			Vector3 z(m_rows[0][2], m_rows[1][2], m_rows[2][2]) ;
+			float invDet = 1.0f/(x*(y^z)) ;
+			Transform result ;
+			result.m_rows[0] = (y^z)*invDet ;
+			result.m_rows[1] = (z^x)*invDet ;
+			result.m_rows[2] = (x^y)*invDet ;
+			result.m_translation = -result.transformVector(m_translation) ;
+			return result ;
+		}
+	} ;
+}
+
+#endif
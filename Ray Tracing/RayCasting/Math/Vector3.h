@@ -18,7 +18,7 @@ namespace Math
 	///
 	/// \brief	A 3D vector.
 	///
-	/// \author	F. Lamarche, Universit de Rennes 1
+	/// \author	F. Lamarche, Université de Rennes 1
 	/// \date	03/12/2013
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	class Vector3 : public Object
@@ -34,7 +34,7 @@ namespace Math
 		///
 		/// \brief	Constructor.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		///
 		/// \param	x	The x coordinate.
@@ -53,7 +53,7 @@ namespace Math
 		///
 		/// \brief	Array indexer operator.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		///
 		/// \param	index	Zero-based index of the corrdinate to retreive.
@@ -68,7 +68,7 @@ namespace Math
 		///
 		/// \brief	Array indexer operator.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		///
 		/// \param	index	Zero-based index of the coordinate to retreive.
@@ -83,7 +83,7 @@ namespace Math
 		///
 		/// \brief	Addition operator.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		///
 		/// \param	v	The other vector
@@ -103,7 +103,7 @@ namespace Math
 		///
 		/// \brief	Soustraction operator.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		///
 		/// \param	v	The other vector.
@@ -123,7 +123,7 @@ namespace Math
 		///
 		/// \brief	Negation operator.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		///
 		/// \return	The result of the operation.
@@ -141,7 +141,7 @@ namespace Math
 		///
 		/// \brief	Dot product operator.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		///
 		/// \param	v	The other vector
@@ -162,7 +162,7 @@ namespace Math
 		///
 		/// \brief	Multiplication by a scalar.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		///
 		/// \param	v	The scalar
@@ -182,7 +182,7 @@ namespace Math
 		///
 		/// \brief	Division by a scalar.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		///
 		/// \param	v	The scalar.
@@ -202,7 +202,7 @@ namespace Math
 		///
 		/// \brief	Cross product.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		///
 		/// \param	v	The other vector.
@@ -223,7 +223,7 @@ namespace Math
 		///
 		/// \brief	Gets the squared norm of the vector.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		///
 		/// \return	.
@@ -238,7 +238,7 @@ namespace Math
 		///
 		/// \brief	Gets the norm of the vector.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		///
 		/// \return	.
@@ -251,7 +251,7 @@ namespace Math
 		///
 		/// \brief	Gets the normalized vector corresponding to this instance.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		///
 		/// \return	.
@@ -266,7 +266,7 @@ namespace Math
 		///
 		/// \brief	Fills the vector with a given scalar
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		///
 		/// \param	s	The value of all coordinates.
@@ -285,7 +285,7 @@ namespace Math
 		///
 		/// \brief	Gets the peudo inverse of the vector.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		///
 		/// \return	.
@@ -298,7 +298,7 @@ namespace Math
 		///
 		/// \brief	Gets the size of the vector.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		///
 		/// \return	.
@@ -312,7 +312,7 @@ namespace Math
 		/// \brief	SIMD minimum. Returns vector for each each component is the minimum of the corresponding 
 		/// 		component in this and v.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	09/12/2013
 		///
 		/// \param	v	The other vector.
@@ -331,7 +331,7 @@ namespace Math
 		/// 		component in this and v.
 		///
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	09/12/2013
 		///
 		/// \param	v	The other vector.
@@ -348,7 +348,7 @@ namespace Math
 		///
 		/// \brief	SIMD mul. Multiplication of v and this, component by component.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	09/12/2013
 		///
 		/// \param	v	The Math::Vector3 const &amp; to process.
@@ -365,7 +365,7 @@ namespace Math
 		///
 		/// \brief	SIMD div. Division of each coordinate of this by each corresponding coordinate in v.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	09/12/2013
 		///
 		/// \param	v	The Math::Vector3 const &amp; to process.
@@ -382,7 +382,7 @@ namespace Math
 		///
 		/// \brief	Gets the SIMD inverse. Returns (1.0/x, 1.0/y,1.0/z).
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	09/12/2013
 		///
 		/// \return	.
@@ -405,7 +405,7 @@ namespace Math
 	///
 	/// \brief	Stream insertion operator of a vector.
 	///
-	/// \author	F. Lamarche, Universit de Rennes 1
+	/// \author	F. Lamarche, Université de Rennes 1
 	/// \date	03/12/2013
 	///
 	/// \param [in,out]	out	The output stream.
@@ -164,6 +164,46 @@ inline float const & get(Math::sse::Float4 const & v, int index)
 	return v.m128_f32[index] ;
 }
 
+///////////////////////////////////////////////////////////////////////////////////
+/// \brief Loads four floats from a 16 bytes aligned address
+/// 
+/// \param address
+/// \return (address[0], address[1], address[2], address[3])
+/// 
+/// \author L. Foucault & V. Goupoil, University of Rennes 1.
+///////////////////////////////////////////////////////////////////////////////////
+inline Math::sse::Float4 loadFloat4(const float * address)
+{
+	return _mm_load_ps(address) ;
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+/// \brief Stores four floats at a 16 bytes aligned address
+/// 
+/// \param address
+/// \param v
+/// 
+/// \author L. Foucault & V. Goupoil, University of Rennes 1.
+///////////////////////////////////////////////////////////////////////////////////
+inline void store(float * address, Math::sse::Float4 const & v)
+{
+	_mm_store_ps(address, v) ;
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+/// \brief Gathers the sign bits of the components (typically the result of a 
+/// comparison) in an integer
+/// 
+/// \param v
+/// \return bit i is set if the sign bit of v[i] is set
+/// 
+/// \author L. Foucault & V. Goupoil, University of Rennes 1.
+///////////////////////////////////////////////////////////////////////////////////
+inline int signMask(Math::sse::Float4 const & v)
+{
+	return _mm_movemask_ps(v) ;
+}
+
 inline float dot(Math::sse::Float4 const & v0, Math::sse::Float4 const & v1)
 { return  get(_mm_dp_ps(v0, v1, 0xFF),0) ; }
 
@@ -225,7 +265,7 @@ Math::sse::Float4 shuffle(Math::sse::Float4 const & v0, Math::sse::Float4 const
 ///
 /// \brief	Shuffles the given v.
 ///
-/// \author	F. Lamarche, Universit de Rennes 1
+/// \author	F. Lamarche, Université de Rennes 1
 /// \date	11/12/2013
 ///
 /// \tparam	int i0	Type of the int i 0.
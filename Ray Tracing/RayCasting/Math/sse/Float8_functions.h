@@ -0,0 +1,120 @@
+#ifndef _Rennes1_Math_sse_Float8_H
+#define _Rennes1_Math_sse_Float8_H
+
+#include <assert.h>
+#include <immintrin.h>
+
+namespace Math
+{
+		namespace sse
+		{
+			////////////////////////////////////////////////////////////////////////////////////////////////////
+			/// \brief	Eight floats processed with AVX instructions. This layer only provides the operations
+			/// 		needed by the 8 wide kernels (see Geometry::WideBVH) and requires a CPU supporting AVX.
+			///
+			/// \author	L. Foucault & V. Goupoil, University of Rennes 1.
+			////////////////////////////////////////////////////////////////////////////////////////////////////
+			typedef __m256 Float8 ;
+		}
+}
+
+inline Math::sse::Float8 makeFloat8(float value)
+{
+	return _mm256_set1_ps(value) ;
+}
+
+inline Math::sse::Float8 operator +(Math::sse::Float8 const & v0, Math::sse::Float8 const & v1)
+{
+	return _mm256_add_ps(v0, v1) ;
+}
+
+inline Math::sse::Float8 operator -(Math::sse::Float8 const & v0, Math::sse::Float8 const & v1)
+{
+	return _mm256_sub_ps(v0, v1) ;
+}
+
+inline Math::sse::Float8 operator *(Math::sse::Float8 const & v0, Math::sse::Float8 const & v1)
+{
+	return _mm256_mul_ps(v0, v1) ;
+}
+
+inline Math::sse::Float8 operator /(Math::sse::Float8 const & v0, Math::sse::Float8 const & v1)
+{
+	return _mm256_div_ps(v0, v1) ;
+}
+
+inline Math::sse::Float8 operator &(Math::sse::Float8 const & v0, Math::sse::Float8 const & v1)
+{
+	return _mm256_and_ps(v0, v1) ;
+}
+
+inline Math::sse::Float8 operator |(Math::sse::Float8 const & v0, Math::sse::Float8 const & v1)
+{
+	return _mm256_or_ps(v0, v1) ;
+}
+
+inline Math::sse::Float8 simdLess(Math::sse::Float8 const & v0, Math::sse::Float8 const & v1)
+{
+	return _mm256_cmp_ps(v0, v1, _CMP_LT_OQ) ;
+}
+
+inline Math::sse::Float8 simdLessEquals(Math::sse::Float8 const & v0, Math::sse::Float8 const & v1)
+{
+	return _mm256_cmp_ps(v0, v1, _CMP_LE_OQ) ;
+}
+
+inline Math::sse::Float8 simdGreater(Math::sse::Float8 const & v0, Math::sse::Float8 const & v1)
+{
+	return _mm256_cmp_ps(v0, v1, _CMP_GT_OQ) ;
+}
+
+inline Math::sse::Float8 simdGreaterEquals(Math::sse::Float8 const & v0, Math::sse::Float8 const & v1)
+{
+	return _mm256_cmp_ps(v0, v1, _CMP_GE_OQ) ;
+}
+
+inline Math::sse::Float8 abs(Math::sse::Float8 const & v)
+{
+	return _mm256_andnot_ps(makeFloat8(-0.0f), v) ;
+}
+
+inline Math::sse::Float8 min(Math::sse::Float8 const & v0, Math::sse::Float8 const & v1)
+{ return _mm256_min_ps(v0, v1) ; }
+
+inline Math::sse::Float8 max(Math::sse::Float8 const & v0, Math::sse::Float8 const & v1)
+{ return _mm256_max_ps(v0, v1) ; }
+
+///////////////////////////////////////////////////////////////////////////////////
+/// \brief Loads eight floats from a 32 bytes aligned address
+/// 
+/// \author L. Foucault & V. Goupoil, University of Rennes 1.
+///////////////////////////////////////////////////////////////////////////////////
+inline Math::sse::Float8 loadFloat8(const float * address)
+{
+	return _mm256_load_ps(address) ;
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+/// \brief Stores eight floats at a 32 bytes aligned address
+/// 
+/// \author L. Foucault & V. Goupoil, University of Rennes 1.
+///////////////////////////////////////////////////////////////////////////////////
+inline void store(float * address, Math::sse::Float8 const & v)
+{
+	_mm256_store_ps(address, v) ;
+}
+
+///////////////////////////////////////////////////////////////////////////////////
+/// \brief Gathers the sign bits of the components (typically the result of a 
+/// comparison) in an integer
+/// 
+/// \return bit i is set if the sign bit of v[i] is set
+/// 
+/// \author L. Foucault & V. Goupoil, University of Rennes 1.
+///////////////////////////////////////////////////////////////////////////////////
+inline int signMask(Math::sse::Float8 const & v)
+{
+	return _mm256_movemask_ps(v) ;
+}
+
+#endif
\ No newline at end of file
@@ -63,7 +63,7 @@ namespace Math
 		///
 		/// \brief	Constructor.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	08/12/2013
 		///
 		/// \param	x	The x coordinate.
@@ -289,7 +289,7 @@ namespace Math
 		///
 		/// \brief	Cross product.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		///
 		/// \param	v	The other vector.
@@ -313,7 +313,7 @@ namespace Math
 		/// 		component in this and v.
 		///
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	09/12/2013
 		///
 		/// \param	v	The other vector.
@@ -332,7 +332,7 @@ namespace Math
 		/// 		component in this and v.
 		///
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	09/12/2013
 		///
 		/// \param	v	The other vector.
@@ -349,7 +349,7 @@ namespace Math
 		///
 		/// \brief	SIMD mul. Multiplication of v and this, component by component.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	09/12/2013
 		///
 		/// \param	v	The Math::Vector3 const &amp; to process.
@@ -366,7 +366,7 @@ namespace Math
 		///
 		/// \brief	SIMD div. Division of each coordinate of this by each corresponding coordinate in v.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	09/12/2013
 		///
 		/// \param	v	The Math::Vector3 const &amp; to process.
@@ -383,7 +383,7 @@ namespace Math
 		///
 		/// \brief	Gets the SIMD inverse. Returns (1.0/x, 1.0/y,1.0/z).
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	09/12/2013
 		///
 		/// \return	.
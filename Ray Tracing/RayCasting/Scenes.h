@@ -0,0 +1,339 @@
+#ifndef _Scenes_H
+#define _Scenes_H
+
+#include <Math/Vector3.h>
+#include <Geometry/Ray.h>
+#include <Geometry/Triangle.h>
+#include <Geometry/CastedRay.h>
+#include <Geometry/RGBColor.h>
+#include <Geometry/Material.h>
+#include <Geometry/PointLight.h>
+#include <Geometry/Camera.h>
+#include <Geometry/Cube.h>
+#include <Geometry/Disk.h>
+#include <Geometry/Cone.h>
+#include <Geometry/Scene.h>
+#include <Geometry/Cornel.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \namespace	Scenes
+///
+/// \brief	The built-in scenes, shared by the application (main.cpp) and the benchmark
+/// 		(Benchmark/Benchmark.cpp).
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace Scenes
+{
+	using Geometry::RGBColor;
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \fn	void Scenes::initDiffuse(Geometry::Scene & scene)
+	///
+	/// \brief	Adds a Cornell Box with diffuse material on each walls to the scene. This Cornel box
+	/// 		contains two cubes.
+	///
+	/// \author	F. Lamarche, Université de Rennes 1
+	/// \date	03/12/2013
+	///
+	/// \param [in,out]	scene	The scene.
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	inline void initDiffuse(Geometry::Scene & scene)
+	{
+		// MURS
+		Geometry::Material * floor		= new Geometry::Material(RGBColor(), RGBColor(1, 1, 1), RGBColor(), 1, RGBColor(), 0.0);
+		Geometry::Material * mirror		= new Geometry::Material(RGBColor(), RGBColor(), RGBColor(1, 1, 1), 1000, RGBColor(), 0.0);
+		// OBJETS DANS LA SCENE
+		Geometry::Material * red		= new Geometry::Material(RGBColor(), RGBColor(1, 0, 0), RGBColor(), 1, RGBColor(), 0.0);
+		Geometry::Material * green		= new Geometry::Material(RGBColor(), RGBColor(0, 1, 0), RGBColor(), 1, RGBColor(), 0.0);
+		Geometry::Material * blue		= new Geometry::Material(RGBColor(), RGBColor(0, 0, 1), RGBColor(), 1, RGBColor(), 0.0);
+		Geometry::Material * purple		= new Geometry::Material(RGBColor(), RGBColor(1, 0, 1), RGBColor(), 1, RGBColor(), 0.0);
+		// CONSTRUCTION DES MURS
+		Geometry::Cornel geo(floor, floor, floor, floor, floor, floor); 
+
+		geo.scaleX(10);
+		geo.scaleY(10);
+		geo.scaleZ(10);
+		scene.add(geo);
+
+
+		Geometry::Cube cube1(red);
+		cube1.translate(Math::Vector3(0, 1, 1));
+		scene.add(cube1);
+		
+		Geometry::Cube cube2(green);
+		cube2.translate(Math::Vector3(0, 1, -1));
+		scene.add(cube2);
+
+		Geometry::Cube cube3(blue);
+		cube3.translate(Math::Vector3(0, -1, 1));
+		scene.add(cube3);
+
+		Geometry::Cube cube4(purple);
+		cube4.translate(Math::Vector3(0, -1, -1));
+		scene.add(cube4);
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \fn	void Scenes::initSpecular(Geometry::Scene & scene)
+	///
+	/// \brief	Adds a Cornel box in the provided scene. Walls are specular and the box contains two 
+	/// 		cubes.
+	///
+	/// \author	F. Lamarche, Université de Rennes 1
+	/// \date	03/12/2013
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	inline void initSpecular(Geometry::Scene & scene)
+	{
+		// MURS
+		Geometry::Material * floor		= new Geometry::Material(RGBColor(), RGBColor(1, 1, 1), RGBColor(), 1, RGBColor(), 0.0);
+		Geometry::Material * mirror		= new Geometry::Material(RGBColor(), RGBColor(), RGBColor(1, 1, 1), 1000, RGBColor(), 0.0);
+		// OBJETS DANS LA SCENE
+		Geometry::Material * red		= new Geometry::Material(RGBColor(), RGBColor(), RGBColor(1, 0, 0), 20, RGBColor(), 0.0);
+		Geometry::Material * green		= new Geometry::Material(RGBColor(), RGBColor(), RGBColor(0, 1, 0), 20, RGBColor(), 0.0);
+		Geometry::Material * blue		= new Geometry::Material(RGBColor(), RGBColor(), RGBColor(0, 0, 1), 20, RGBColor(), 0.0);
+		Geometry::Material * purple		= new Geometry::Material(RGBColor(), RGBColor(), RGBColor(1, 0, 1), 20, RGBColor(), 0.0);
+		// CONSTRUCTION DES MURS
+		Geometry::Cornel geo(mirror, mirror, mirror, mirror, mirror, mirror);
+
+		geo.scaleX(10);
+		geo.scaleY(10);
+		geo.scaleZ(10);
+		scene.add(geo);
+
+
+		Geometry::Cube cube1(red);
+		cube1.translate(Math::Vector3(0, 1, 1));
+		scene.add(cube1);
+		
+		Geometry::Cube cube2(green);
+		cube2.translate(Math::Vector3(0, 1, -1));
+		scene.add(cube2);
+
+		Geometry::Cube cube3(blue);
+		cube3.translate(Math::Vector3(0, -1, 1));
+		scene.add(cube3);
+
+		Geometry::Cube cube4(purple);
+		cube4.translate(Math::Vector3(0, -1, -1));
+		scene.add(cube4);
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \fn	void Scenes::initDiffuseSpecular(Geometry::Scene & scene)
+	///
+	/// \brief	Adds a Cornel box in the provided scene. The cornel box as diffuse and specular walls and 
+	/// 		contains two boxes.
+	///
+	/// \author	F. Lamarche, Université de Rennes 1
+	/// \date	03/12/2013
+	///
+	/// \param [in,out]	scene	The scene.
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	inline void initDiffuseSpecular(Geometry::Scene & scene)
+	{
+		// MURS
+		Geometry::Material * floor		= new Geometry::Material(RGBColor(), RGBColor(1, 1, 1), RGBColor(), 1000, RGBColor(), 0.0);
+		Geometry::Material * mirror		= new Geometry::Material(RGBColor(), RGBColor(), RGBColor(1, 1, 1), 100, RGBColor(), 0.0);
+		// OBJETS DANS LA SCENE
+		Geometry::Material * red		= new Geometry::Material(RGBColor(), RGBColor(1, 0, 0), RGBColor(), 20, RGBColor(), 0.0);
+		Geometry::Material * green		= new Geometry::Material(RGBColor(), RGBColor(0, 1, 0), RGBColor(), 20, RGBColor(), 0.0);
+		Geometry::Material * blue		= new Geometry::Material(RGBColor(), RGBColor(0, 0, 1), RGBColor(), 20, RGBColor(), 0.0);
+		Geometry::Material * purple		= new Geometry::Material(RGBColor(), RGBColor(1, 0, 1), RGBColor(), 20, RGBColor(), 0.0);
+		// CONSTRUCTION DES MURS
+		Geometry::Cornel geo(floor, floor, mirror, mirror, mirror, mirror);
+
+		geo.scaleX(10);
+		geo.scaleY(10);
+		geo.scaleZ(10);
+		scene.add(geo);
+
+		
+		Geometry::Cube cube1(red);
+		cube1.translate(Math::Vector3(0, 1, 1));
+		scene.add(cube1);
+		
+		Geometry::Cube cube2(green);
+		cube2.translate(Math::Vector3(0, 1, -1));
+		scene.add(cube2);
+
+		Geometry::Cube cube3(blue);
+		cube3.translate(Math::Vector3(0, -1, 1));
+		scene.add(cube3);
+
+		Geometry::Cube cube4(purple);
+		cube4.translate(Math::Vector3(0, -1, -1));
+		scene.add(cube4);
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \fn	void Scenes::initRefraction(Geometry::Scene & scene)
+	///
+	/// \brief	Adds a Cornel box in the provided scene. The cornel box as diffuse and specular walls and 
+	/// 		contains two boxes.
+	///
+	/// \author	F. Lamarche, Université de Rennes 1
+	/// \date	03/12/2013
+	///
+	/// \param [in,out]	scene	The scene.
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	inline void initRefraction(Geometry::Scene & scene)
+	{
+		// MURS
+		Geometry::Material * floor		= new Geometry::Material(RGBColor(), RGBColor(1, 1, 1), RGBColor(), 1, RGBColor(), 0.0);
+		Geometry::Material * mirror		= new Geometry::Material(RGBColor(), RGBColor(), RGBColor(1, 1, 1), 100, RGBColor(), 0.0);
+		// OBJETS DANS LA SCENE
+		Geometry::Material * red		= new Geometry::Material(RGBColor(), RGBColor(1, 0, 0), RGBColor(), 20, RGBColor(), 0.0);
+		Geometry::Material * green		= new Geometry::Material(RGBColor(), RGBColor(0, 1, 0), RGBColor(), 20, RGBColor(), 0.0);
+		Geometry::Material * blue		= new Geometry::Material(RGBColor(), RGBColor(0, 0, 1), RGBColor(), 20, RGBColor(), 0.0);
+		Geometry::Material * purple		= new Geometry::Material(RGBColor(), RGBColor(1, 0, 1), RGBColor(), 20, RGBColor(), 0.0);
+		
+		Geometry::Material * ice		= new Geometry::Material(RGBColor(), RGBColor(), RGBColor(1, 1, 1), 1, RGBColor(), 1.309);			// GLACE
+		Geometry::Material * water		= new Geometry::Material(RGBColor(), RGBColor(), RGBColor(1, 1, 1), 1, RGBColor(), 1.333);			// EAU
+		Geometry::Material * soda		= new Geometry::Material(RGBColor(), RGBColor(), RGBColor(88, 41, 0), 1, RGBColor(), 1.46);			// SODA
+		Geometry::Material * flintGlass	= new Geometry::Material(RGBColor(), RGBColor(), RGBColor(1, 1, 1), 1, RGBColor(), 1.62);			// VERRE FLINT
+		Geometry::Material * diamond	= new Geometry::Material(RGBColor(), RGBColor(), RGBColor(1, 1, 1), 1, RGBColor(), 2.42);			// DIAMANT
+		// CONSTRUCTION DES MURS
+		Geometry::Cornel geo(floor, floor, mirror, mirror, mirror, mirror);
+
+		geo.scaleX(10);
+		geo.scaleY(10);
+		geo.scaleZ(10);
+		scene.add(geo);
+
+		Geometry::Cube cube1(red);
+		cube1.translate(Math::Vector3(1, 0.7, -4));
+		scene.add(cube1);
+		
+		Geometry::Cube cube2(green);
+		cube2.translate(Math::Vector3(1, -0.7, -4));
+		scene.add(cube2);
+
+		Geometry::Cone cone1(100, water);
+		cone1.translate(Math::Vector3(0, 0, -1));
+		scene.add(cone1);
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \fn	void Scenes::initAreaLights(Geometry::Scene & scene)
+	///
+	/// \brief	Adds two emissive white cubes in opposite corners of the Cornel box. The global
+	/// 		illumination integrators ignore the point lights: a scene without emissive objects
+	/// 		renders black.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	///
+	/// \param [in,out]	scene	The scene.
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	inline void initAreaLights(Geometry::Scene & scene)
+	{
+		Geometry::Material * emissiveWhite		= new Geometry::Material(RGBColor(), RGBColor(), RGBColor(), 1, RGBColor(500, 500, 500), 0.0);
+
+		Geometry::Cube light1(emissiveWhite);
+		light1.translate(Math::Vector3(4, -4, -4));
+		scene.add(light1);
+
+		Geometry::Cube light2(emissiveWhite);
+		light2.translate(Math::Vector3(-4, 4, 4));
+		scene.add(light2);
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \fn	void Scenes::initEmissive(Geometry::Scene & scene)
+	///
+	/// \brief	Adds a Cornel box in the provided scene. The cornel box as diffuse and specular walls and 
+	/// 		contains two boxes.
+	///
+	/// \author	F. Lamarche, Université de Rennes 1
+	/// \date	03/12/2013
+	///
+	/// \param [in,out]	scene	The scene.
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	inline void initEmissive(Geometry::Scene & scene)
+	{
+		// MURS
+		Geometry::Material * floorRed		= new Geometry::Material(RGBColor(), RGBColor(1, 0, 0), RGBColor(), 1, RGBColor(), 0.0);
+		Geometry::Material * floorGreen		= new Geometry::Material(RGBColor(), RGBColor(0, 1, 0), RGBColor(), 1, RGBColor(), 0.0);
+		Geometry::Material * floorBlue		= new Geometry::Material(RGBColor(), RGBColor(0, 0, 1), RGBColor(), 1, RGBColor(), 0.0);
+		Geometry::Material * floorYellow	= new Geometry::Material(RGBColor(), RGBColor(1, 1, 0), RGBColor(), 1, RGBColor(), 0.0);
+		Geometry::Material * floorPurple	= new Geometry::Material(RGBColor(), RGBColor(1, 0, 1), RGBColor(), 1, RGBColor(), 0.0);
+		Geometry::Material * floorOrange	= new Geometry::Material(RGBColor(), RGBColor(0, 1, 1), RGBColor(), 1, RGBColor(), 0.0);
+		Geometry::Material * mirror			= new Geometry::Material(RGBColor(), RGBColor(), RGBColor(1, 1, 1), 1000, RGBColor(), 0.0);
+		// OBJETS DANS LA SCENE
+		Geometry::Material * red		= new Geometry::Material(RGBColor(), RGBColor(1, 0, 0), RGBColor(1, 0, 0), 20, RGBColor(), 0.0);
+		Geometry::Material * green		= new Geometry::Material(RGBColor(), RGBColor(0, 1, 0), RGBColor(0, 1, 0), 20, RGBColor(), 0.0);
+		Geometry::Material * blue		= new Geometry::Material(RGBColor(), RGBColor(0, 0, 1), RGBColor(0, 0, 1), 20, RGBColor(), 0.0);
+		Geometry::Material * purple		= new Geometry::Material(RGBColor(), RGBColor(1, 0, 1), RGBColor(1, 0, 1), 20, RGBColor(), 0.0);
+
+		Geometry::Material * emissiveGreen		= new Geometry::Material(RGBColor(), RGBColor(), RGBColor(), 1, RGBColor(0, 500, 0), 0.0);
+		Geometry::Material * emissiveYellow		= new Geometry::Material(RGBColor(), RGBColor(), RGBColor(), 1, RGBColor(500, 500, 0), 0.0);
+		// CONSTRUCTION DES MURS
+		Geometry::Cornel geo(floorRed, floorGreen, floorOrange, floorPurple, floorYellow, floorBlue);
+
+		geo.scaleX(10);
+		geo.scaleY(10);
+		geo.scaleZ(10);
+		scene.add(geo);
+
+		initAreaLights(scene);
+		
+		Geometry::Cube cube1(red);
+		cube1.translate(Math::Vector3(0, 1, -1));
+		scene.add(cube1);
+
+		Geometry::Cube cube2(blue);
+		cube2.translate(Math::Vector3(0, 1, 1));
+		scene.add(cube2);
+
+		Geometry::Cube cube3(purple);
+		cube3.translate(Math::Vector3(0, -1, -1));
+		scene.add(cube3);
+
+		Geometry::Cube cube4(green);
+		cube4.translate(Math::Vector3(0, -1, 1));
+		scene.add(cube4);
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \fn	void Scenes::initLights(Geometry::Scene & scene)
+	///
+	/// \brief	Adds the point lights shared by all the scenes.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	///
+	/// \param [in,out]	scene	The scene.
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	inline void initLights(Geometry::Scene & scene)
+	{
+		{
+			Geometry::PointLight pointLight(Math::Vector3(-2, 1, 1), RGBColor(0.5, 0.5, 0.5));
+			scene.add(pointLight);
+		}
+		{
+			Geometry::PointLight pointLight2(Math::Vector3(4, 0, 0), RGBColor(0.5, 0.5, 0.5));
+			scene.add(pointLight2);
+		}
+		{
+			Geometry::PointLight pointLight3(Math::Vector3(-3, 2, 1), RGBColor(0.5, 0.5, 0.5));
+			scene.add(pointLight3);
+		}
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \fn	void Scenes::initCamera(Geometry::Scene & scene)
+	///
+	/// \brief	Sets the camera shared by all the scenes, looking at the center of the Cornel box.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	///
+	/// \param [in,out]	scene	The scene.
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	inline void initCamera(Geometry::Scene & scene)
+	{
+		Geometry::Camera camera(Math::Vector3(-4.0f, 0.0, 0.0), Math::Vector3(0.0, 0.0, 0.0), 0.3f, 1.0f, 1.0f);
+		scene.setCamera(camera);
+	}
+}
+
+#endif
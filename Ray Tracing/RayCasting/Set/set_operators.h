@@ -11,7 +11,7 @@
 ///
 /// \brief	Adds an element at the end of a given ::std::vector<T>
 ///
-/// \author	F. Lamarche, Universit de Rennes 1
+/// \author	F. Lamarche, Université de Rennes 1
 /// \date	03/12/2013
 ///
 /// \tparam	T	Generic type parameter.
@@ -33,7 +33,7 @@ std::vector<T> & operator+=(std::vector<T> & v, T const & s)
 ///
 /// \brief	Adds the elements contained in set s in vector v.
 ///
-/// \author	F. Lamarche, Universit de Rennes 1
+/// \author	F. Lamarche, Université de Rennes 1
 /// \date	03/12/2013
 ///
 /// \tparam	T  	Generic type parameter.
@@ -62,7 +62,7 @@ inline std::vector<T> & operator+=(std::vector<T> & v, std::set<T, Cmp> const &
 ///
 /// \brief	Contatenates elements in s at the end of v.
 ///
-/// \author	F. Lamarche, Universit de Rennes 1
+/// \author	F. Lamarche, Université de Rennes 1
 /// \date	03/12/2013
 ///
 /// \tparam	T	Generic type parameter.
@@ -89,7 +89,7 @@ inline std::vector<T> & operator+=(std::vector<T> & v, std::vector<T> const & s)
 ///
 /// \brief	Tests if an element is contained in a given set.
 ///
-/// \author	F. Lamarche, Universit de Rennes 1
+/// \author	F. Lamarche, Université de Rennes 1
 /// \date	03/12/2013
 ///
 /// \tparam	T  	Generic type parameter.
@@ -111,7 +111,7 @@ inline bool in(T const & e, std::set<T, Cmp> const & s)
 ///
 /// \brief	Adds an element in a set.
 ///
-/// \author	F. Lamarche, Universit de Rennes 1
+/// \author	F. Lamarche, Université de Rennes 1
 /// \date	03/12/2013
 ///
 /// \tparam	T  	Generic type parameter.
@@ -136,7 +136,7 @@ inline std::set<T, Cmp> & operator+=(std::set<T, Cmp> & s, T const & e)
 ///
 /// \brief	Removes an element from a set.
 ///
-/// \author	F. Lamarche, Universit de Rennes 1
+/// \author	F. Lamarche, Université de Rennes 1
 /// \date	03/12/2013
 ///
 /// \tparam	T  	Generic type parameter.
@@ -161,7 +161,7 @@ inline std::set<T, Cmp> & operator-=(std::set<T, Cmp> & s, T const & e)
 ///
 /// \brief	Adds a collection of elements into a set.
 /// 		
-/// \author	F. Lamarche, Universit de Rennes 1
+/// \author	F. Lamarche, Université de Rennes 1
 /// \date	03/12/2013
 ///
 /// \tparam	T  	Generic type parameter.
@@ -187,7 +187,7 @@ std::set<T, Cmp> & operator+=(std::set<T, Cmp> & s, std::list<T> const & l)
 ///
 /// \brief	Removes a collection of elements from a set.
 ///
-/// \author	F. Lamarche, Universit de Rennes 1
+/// \author	F. Lamarche, Université de Rennes 1
 /// \date	03/12/2013
 ///
 /// \tparam	T1 	Generic type parameter.
@@ -214,7 +214,7 @@ std::set<T1, Cmp> & operator-=(std::set<T1, Cmp> & s, std::list<T2> const & l)
 ///
 /// \brief	Adds a collection of elements in a set.
 ///
-/// \author	F. Lamarche, Universit de Rennes 1
+/// \author	F. Lamarche, Université de Rennes 1
 /// \date	03/12/2013
 ///
 /// \tparam	T  	Generic type parameter.
@@ -240,7 +240,7 @@ std::set<T, Cmp> & operator+=(std::set<T, Cmp> & s, std::vector<T> const & l)
 ///
 /// \brief	Removes a collection of elements from a given set.
 ///
-/// \author	F. Lamarche, Universit de Rennes 1
+/// \author	F. Lamarche, Université de Rennes 1
 /// \date	03/12/2013
 ///
 /// \tparam	T1 	Generic type parameter.
@@ -267,7 +267,7 @@ std::set<T1, Cmp> & operator-=(std::set<T1, Cmp> & s, std::vector<T2> const & l)
 ///
 /// \brief	Adds a collection of elements in a given set.
 ///
-/// \author	F. Lamarche, Universit de Rennes 1
+/// \author	F. Lamarche, Université de Rennes 1
 /// \date	03/12/2013
 ///
 /// \tparam	T  	Generic type parameter.
@@ -293,7 +293,7 @@ std::set<T, Cmp> & operator+=(std::set<T, Cmp> & s1, std::set<T, Cmp> const & s2
 ///
 /// \brief	Removes a collection of elements from a given set.
 ///
-/// \author	F. Lamarche, Universit de Rennes 1
+/// \author	F. Lamarche, Université de Rennes 1
 /// \date	03/12/2013
 ///
 /// \tparam	T  	Generic type parameter.
@@ -319,7 +319,7 @@ std::set<T, Cmp> & operator-=(std::set<T, Cmp> & s1, std::set<T, Cmp> const & s2
 ///
 /// \brief	Computes the intersection between s1 and s2 and stores the result in s1.
 ///
-/// \author	F. Lamarche, Universit de Rennes 1
+/// \author	F. Lamarche, Université de Rennes 1
 /// \date	03/12/2013
 ///
 /// \tparam	T  	Generic type parameter.
@@ -348,7 +348,7 @@ std::set<T, Cmp> & operator*=(std::set<T, Cmp> & s1, std::set<T, Cmp> const & s2
 ///
 /// \brief	Computes the union of to sets.
 ///
-/// \author	F. Lamarche, Universit de Rennes 1
+/// \author	F. Lamarche, Université de Rennes 1
 /// \date	03/12/2013
 ///
 /// \tparam	T  	Generic type parameter.
@@ -379,7 +379,7 @@ inline std::set<T, Cmp> operator+(std::set<T, Cmp> const & s1, std::set<T, Cmp>
 ///
 /// \brief	Computes the difference between two sets.
 ///
-/// \author	F. Lamarche, Universit de Rennes 1
+/// \author	F. Lamarche, Université de Rennes 1
 /// \date	03/12/2013
 ///
 /// \tparam	T  	Generic type parameter.
@@ -408,7 +408,7 @@ inline std::set<T, Cmp> operator-(std::set<T, Cmp> const & s1, std::set<T, Cmp>
 ///
 /// \brief	Intersection between two sets.
 ///
-/// \author	F. Lamarche, Universit de Rennes 1
+/// \author	F. Lamarche, Université de Rennes 1
 /// \date	03/12/2013
 ///
 /// \tparam	T  	Generic type parameter.
@@ -440,7 +440,7 @@ inline std::set<T, Cmp> operator*(std::set<T, Cmp> const & s1, std::set<T, Cmp>
 ///
 /// \brief	Symetric difference between two sets
 ///
-/// \author	F. Lamarche, Universit de Rennes 1
+/// \author	F. Lamarche, Université de Rennes 1
 /// \date	03/12/2013
 ///
 /// \tparam	T  	Generic type parameter.
@@ -473,7 +473,7 @@ inline std::set<T, Cmp> operator^(std::set<T, Cmp> const & s1, std::set<T, Cmp>
 ///
 /// \brief	Outputs a set in an ostream
 ///
-/// \author	F. Lamarche, Universit de Rennes 1
+/// \author	F. Lamarche, Université de Rennes 1
 /// \date	03/12/2013
 ///
 /// \param [in,out]	out	The out.
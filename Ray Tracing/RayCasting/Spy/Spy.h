@@ -1,7 +1,7 @@
 /*
  *  Macros d'aide au debug.
- *  Dfinir la macro Use_Spy pour utiliser les fonctionnalits.
- *  Dfinir la macro SpyLevel fournissant le niveau des affichages.
+ *  Définir la macro Use_Spy pour utiliser les fonctionnalités.
+ *  Définir la macro SpyLevel fournissant le niveau des affichages.
  *
 */
 
@@ -0,0 +1,343 @@
+#ifndef _System_Profiler_H
+#define _System_Profiler_H
+
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <cstdio>
+#if defined(_M_IX86) || defined(_M_X64)
+#include <intrin.h>
+#elif defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+namespace System
+{
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \class	Timer
+	///
+	/// \brief	Portable high resolution timer (monotonic clock of the standard library).
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	class Timer
+	{
+	protected:
+		/// \brief	The start time.
+		::std::chrono::steady_clock::time_point m_start ;
+
+	public:
+		/// \brief	Constructor, starts the timer.
+		Timer()
+			: m_start(::std::chrono::steady_clock::now())
+		{}
+
+		/// \brief	Restarts the timer.
+		void reset()
+		{
+			m_start = ::std::chrono::steady_clock::now() ;
+		}
+
+		/// \brief	Time elapsed since the start in seconds.
+		double elapsed() const
+		{
+			return ::std::chrono::duration<double>(::std::chrono::steady_clock::now() - m_start).count() ;
+		}
+	} ;
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \class	Profiler
+	///
+	/// \brief	Breaks the time of the threads down into the stages of a rendering. Each thread owns its
+	/// 		counters (no synchronization while profiling); a Profiler::Scope switches the current
+	/// 		stage of its thread until its destruction. Scopes nest, and the time of a nested scope is
+	/// 		only counted in its own stage (exclusive times): a shadow ray cast while shading is not
+	/// 		counted as shading. The time of a thread outside of any scope is not counted. When the
+	/// 		profiler is disabled, the default, a scope costs a test. Scopes are timed with the time
+	/// 		stamp counter of x86 processors, converted in seconds with the monotonic clock.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	class Profiler
+	{
+	public:
+		/// \brief	The stages of a rendering.
+		enum Stage
+		{
+			/// \brief	Build and refit of the acceleration structures.
+			bvhBuild,
+			/// \brief	Traversal of the rays from the camera.
+			primaryRays,
+			/// \brief	Traversal of the shadow rays.
+			shadowRays,
+			/// \brief	Traversal of the secondary rays.
+			indirectRays,
+			/// \brief	Everything else in the computation of a sample: sampling, materials, lights.
+			shading,
+			/// \brief	Accumulation in the framebuffer, display and checkpoints.
+			framebufferOutput,
+			/// \brief	Number of stages.
+			stageCount
+		} ;
+
+		/// \brief	The name of a stage in the reports.
+		static const char * stageName(int stage)
+		{
+			static const char * names[stageCount] = { "bvhBuild", "primaryRays", "shadowRays", "indirectRays", "shading", "framebufferOutput" } ;
+			return names[stage] ;
+		}
+
+	protected:
+		typedef ::std::chrono::steady_clock Clock ;
+
+		/// \brief	Reads the time stamp counter (the monotonic clock on other processors).
+		static long long ticks()
+		{
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+			return (long long)__rdtsc() ;
+#else
+			return (long long)Clock::now().time_since_epoch().count() ;
+#endif
+		}
+
+		/// \brief	The counters of a thread (on their own cache lines).
+		struct alignas(64) Counters
+		{
+			/// \brief	Time spent in each stage in ticks.
+			long long m_time[stageCount] ;
+			/// \brief	Number of scopes of each stage.
+			long long m_calls[stageCount] ;
+			/// \brief	The current stage of the thread (-1: none).
+			int m_stage ;
+			/// \brief	The time of the last change of stage in ticks.
+			long long m_last ;
+
+			Counters()
+				: m_stage(-1), m_last(0)
+			{
+				clear() ;
+			}
+
+			void clear()
+			{
+				for(int stage=0 ; stage<stageCount ; ++stage)
+				{
+					m_time[stage] = 0 ;
+					m_calls[stage] = 0 ;
+				}
+			}
+
+			/// \brief	Charges the time since the last change to the current stage and enters a stage.
+			void enter(int stage)
+			{
+				long long now = ticks() ;
+				if(m_stage>=0)
+				{
+					m_time[m_stage] += now-m_last ;
+				}
+				m_last = now ;
+				m_stage = stage ;
+			}
+		} ;
+
+		/// \brief	Is profiling enabled?
+		bool m_enabled ;
+		/// \brief	The counters of the threads that have entered a scope.
+		::std::deque<Counters> m_threads ;
+		/// \brief	Protects m_threads.
+		mutable ::std::mutex m_mutex ;
+		/// \brief	Time of the last reset, to convert ticks in seconds.
+		Clock::time_point m_resetTime ;
+		/// \brief	Ticks of the last reset.
+		long long m_resetTicks ;
+
+		Profiler()
+			: m_enabled(false), m_resetTime(Clock::now()), m_resetTicks(ticks())
+		{}
+
+		/// \brief	Number of ticks per second, measured since the last reset.
+		double ticksPerSecond() const
+		{
+			double seconds = ::std::chrono::duration<double>(Clock::now() - m_resetTime).count() ;
+			return seconds > 0.0 ? (double)(ticks() - m_resetTicks) / seconds : 1.0 ;
+		}
+
+		/// \brief	The counters of the calling thread.
+		static Counters & local()
+		{
+			thread_local Counters * counters = instance().addThread() ;
+			return *counters ;
+		}
+
+		Counters * addThread()
+		{
+			::std::lock_guard<::std::mutex> lock(m_mutex) ;
+			m_threads.push_back(Counters()) ;
+			return &m_threads.back() ;
+		}
+
+		/// \brief	Total time and number of scopes of a stage, over all the threads or for one thread.
+		void total(int stage, int thread, double ticksPerSecond, double & seconds, long long & calls) const
+		{
+			long long time = 0 ;
+			calls = 0 ;
+			for(int cpt=0 ; cpt<(int)m_threads.size() ; ++cpt)
+			{
+				if(thread>=0 && cpt!=thread) continue ;
+				time += m_threads[cpt].m_time[stage] ;
+				calls += m_threads[cpt].m_calls[stage] ;
+			}
+			seconds = (double)time / ticksPerSecond ;
+		}
+
+	public:
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \class	Scope
+		///
+		/// \brief	Counts the time until its destruction in a stage (see Profiler).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		class Scope
+		{
+		protected:
+			/// \brief	The counters of the thread (NULL if the profiler is disabled).
+			Counters * m_counters ;
+			/// \brief	The stage of the thread before this scope.
+			int m_previous ;
+
+		public:
+			Scope(Stage stage)
+				: m_counters(NULL), m_previous(-1)
+			{
+				if(!instance().m_enabled)
+					return ;
+				m_counters = &local() ;
+				m_previous = m_counters->m_stage ;
+				m_counters->m_calls[stage]++ ;
+				m_counters->enter(stage) ;
+			}
+
+			~Scope()
+			{
+				if(m_counters!=NULL)
+					m_counters->enter(m_previous) ;
+			}
+
+		private:
+			Scope(Scope const &) ;
+			Scope & operator=(Scope const &) ;
+		} ;
+
+		/// \brief	The profiler of the process.
+		static Profiler & instance()
+		{
+			static Profiler profiler ;
+			return profiler ;
+		}
+
+		/// \brief	Enables or disables profiling (outside of any scope).
+		void setEnabled(bool enabled)
+		{
+			m_enabled = enabled ;
+		}
+
+		/// \brief	Is profiling enabled?
+		bool enabled() const
+		{
+			return m_enabled ;
+		}
+
+		/// \brief	Clears the counters of all the threads (outside of any scope).
+		void reset()
+		{
+			::std::lock_guard<::std::mutex> lock(m_mutex) ;
+			for(Counters & counters : m_threads)
+				counters.clear() ;
+			m_resetTime = Clock::now() ;
+			m_resetTicks = ticks() ;
+		}
+
+		/// \brief	Total time of a stage over all the threads in seconds.
+		double seconds(Stage stage) const
+		{
+			::std::lock_guard<::std::mutex> lock(m_mutex) ;
+			double result ;
+			long long calls ;
+			total(stage, -1, ticksPerSecond(), result, calls) ;
+			return result ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	bool Profiler::writeReport(std::string const & fileName, double wallTime) const
+		///
+		/// \brief	Writes the time and the number of scopes of each stage, in total and for each thread
+		/// 		that has entered a scope since the start of the process. The report is in CSV if the
+		/// 		name of the file ends with ".csv" (columns stage, thread, seconds, calls; the thread of
+		/// 		the totals is "all"), in JSON otherwise.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	fileName	The name of the file.
+		/// \param	wallTime	The duration of the profiled work in seconds.
+		///
+		/// \return	false if the file cannot be written.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		bool writeReport(::std::string const & fileName, double wallTime) const
+		{
+			FILE * file = fopen(fileName.c_str(), "w") ;
+			if(file==NULL)
+				return false ;
+			::std::lock_guard<::std::mutex> lock(m_mutex) ;
+			const int threads = (int)m_threads.size() ;
+			const double frequency = ticksPerSecond() ;
+			double seconds ;
+			long long calls ;
+			bool csv = fileName.size()>=4 && fileName.compare(fileName.size()-4, 4, ".csv")==0 ;
+			if(csv)
+			{
+				fprintf(file, "stage,thread,seconds,calls\n") ;
+				fprintf(file, "wallTime,all,%.6f,1\n", wallTime) ;
+				for(int stage=0 ; stage<stageCount ; ++stage)
+				{
+					total(stage, -1, frequency, seconds, calls) ;
+					fprintf(file, "%s,all,%.6f,%lld\n", stageName(stage), seconds, calls) ;
+					for(int thread=0 ; thread<threads ; ++thread)
+					{
+						total(stage, thread, frequency, seconds, calls) ;
+						fprintf(file, "%s,%d,%.6f,%lld\n", stageName(stage), thread, seconds, calls) ;
+					}
+				}
+			}
+			else
+			{
+				fprintf(file, "{\n  \"wallTime\": %.6f,\n  \"stages\": {", wallTime) ;
+				for(int stage=0 ; stage<stageCount ; ++stage)
+				{
+					total(stage, -1, frequency, seconds, calls) ;
+					fprintf(file, "%s\n    \"%s\": { \"seconds\": %.6f, \"calls\": %lld }", stage==0 ? "" : ",", stageName(stage), seconds, calls) ;
+				}
+				fprintf(file, "\n  },\n  \"threads\": [") ;
+				for(int thread=0 ; thread<threads ; ++thread)
+				{
+					fprintf(file, "%s\n    {", thread==0 ? "" : ",") ;
+					for(int stage=0 ; stage<stageCount ; ++stage)
+					{
+						total(stage, thread, frequency, seconds, calls) ;
+						fprintf(file, "%s \"%s\": %.6f", stage==0 ? "" : ",", stageName(stage), seconds) ;
+					}
+					fprintf(file, " }") ;
+				}
+				fprintf(file, "\n  ]\n}\n") ;
+			}
+			return fclose(file)==0 ;
+		}
+	} ;
+}
+
+#endif
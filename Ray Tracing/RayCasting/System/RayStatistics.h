@@ -0,0 +1,275 @@
+#ifndef _System_RayStatistics_H
+#define _System_RayStatistics_H
+
+#include <deque>
+#include <mutex>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <string>
+
+namespace System
+{
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \class	RayStatistics
+	///
+	/// \brief	Counts the rays cast by a rendering per type, the nodes visited and the triangles
+	/// 		tested by their traversal, and the length of the paths. Each thread increments its own
+	/// 		counters; RayStatistics::merge adds them to the totals at the end of each pass, when the
+	/// 		rendering threads are idle. When the statistics are disabled, the default, counting a ray
+	/// 		costs a test.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	class RayStatistics
+	{
+	public:
+		/// \brief	The types of rays.
+		enum RayType
+		{
+			/// \brief	Rays from the camera.
+			primaryRay,
+			/// \brief	Occlusion tests towards the lights.
+			shadowRay,
+			/// \brief	Rays sampling the diffuse component.
+			diffuseRay,
+			/// \brief	Rays sampling the specular component.
+			specularRay,
+			/// \brief	Rays going through refractive materials.
+			refractedRay,
+			/// \brief	Number of types.
+			rayTypeCount
+		} ;
+
+		/// \brief	Number of bins of the histogram of the path lengths (the last one holds the longer paths).
+		static const int s_pathLengthBins = 16 ;
+
+		/// \brief	The name of a type of rays.
+		static const char * rayTypeName(int type)
+		{
+			static const char * names[rayTypeCount] = { "primary", "shadow", "diffuse", "specular", "refracted" } ;
+			return names[type] ;
+		}
+
+		/// \brief	Counters of a thread or totals.
+		struct alignas(64) Counters
+		{
+			/// \brief	Number of rays of each type.
+			long long m_rays[rayTypeCount] ;
+			/// \brief	Number of nodes visited by the rays of each type.
+			long long m_nodes[rayTypeCount] ;
+			/// \brief	Number of triangles tested by the rays of each type.
+			long long m_triangles[rayTypeCount] ;
+			/// \brief	Number of paths of each length (1 to s_pathLengthBins rays).
+			long long m_pathLengths[s_pathLengthBins] ;
+
+			Counters()
+			{
+				clear() ;
+			}
+
+			void clear()
+			{
+				::std::fill(m_rays, m_rays+rayTypeCount, 0) ;
+				::std::fill(m_nodes, m_nodes+rayTypeCount, 0) ;
+				::std::fill(m_triangles, m_triangles+rayTypeCount, 0) ;
+				::std::fill(m_pathLengths, m_pathLengths+s_pathLengthBins, 0) ;
+			}
+
+			void add(Counters const & other)
+			{
+				for(int type=0 ; type<rayTypeCount ; ++type)
+				{
+					m_rays[type] += other.m_rays[type] ;
+					m_nodes[type] += other.m_nodes[type] ;
+					m_triangles[type] += other.m_triangles[type] ;
+				}
+				for(int bin=0 ; bin<s_pathLengthBins ; ++bin)
+				{
+					m_pathLengths[bin] += other.m_pathLengths[bin] ;
+				}
+			}
+		} ;
+
+	protected:
+		/// \brief	Are the statistics enabled?
+		bool m_enabled ;
+		/// \brief	The counters of the threads that have cast a ray since the last merge.
+		::std::deque<Counters> m_threads ;
+		/// \brief	Protects m_threads.
+		::std::mutex m_mutex ;
+		/// \brief	The merged counters.
+		Counters m_total ;
+		/// \brief	Number of bottom level hierarchies rebuilt by the last update (-1: no update counted).
+		int m_rebuiltHierarchies ;
+		/// \brief	Number of bottom level hierarchies refitted by the last update.
+		int m_refittedHierarchies ;
+		/// \brief	SAH cost of the scene after the last update.
+		float m_sceneSahCost ;
+
+		RayStatistics()
+			: m_enabled(false), m_rebuiltHierarchies(-1), m_refittedHierarchies(0), m_sceneSahCost(0.0f)
+		{}
+
+		/// \brief	The counters of the calling thread.
+		static Counters & local()
+		{
+			thread_local Counters * counters = instance().addThread() ;
+			return *counters ;
+		}
+
+		Counters * addThread()
+		{
+			::std::lock_guard<::std::mutex> lock(m_mutex) ;
+			m_threads.push_back(Counters()) ;
+			return &m_threads.back() ;
+		}
+
+	public:
+		/// \brief	The statistics of the process.
+		static RayStatistics & instance()
+		{
+			static RayStatistics statistics ;
+			return statistics ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	static void RayStatistics::countRay(RayType type, int nodes, int triangles)
+		///
+		/// \brief	Counts a ray cast by the calling thread.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	type	 	The type of the ray.
+		/// \param	nodes	 	The number of nodes visited by its traversal.
+		/// \param	triangles	The number of triangles tested by its traversal.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		static void countRay(RayType type, int nodes, int triangles)
+		{
+			if(!instance().m_enabled)
+				return ;
+			Counters & counters = local() ;
+			counters.m_rays[type]++ ;
+			counters.m_nodes[type] += nodes ;
+			counters.m_triangles[type] += triangles ;
+		}
+
+		/// \brief	Counts a path of the given number of rays cast by the calling thread.
+		static void countPath(int length)
+		{
+			if(!instance().m_enabled || length<1)
+				return ;
+			local().m_pathLengths[::std::min(length, s_pathLengthBins)-1]++ ;
+		}
+
+		/// \brief	Counts an update of the acceleration structures, before the rendering (see Scene::updateBVH).
+		void countHierarchyUpdate(int rebuilt, int refitted, float sahCost)
+		{
+			if(!m_enabled)
+				return ;
+			m_rebuiltHierarchies = rebuilt ;
+			m_refittedHierarchies = refitted ;
+			m_sceneSahCost = sahCost ;
+		}
+
+		/// \brief	Enables or disables the statistics (between two passes).
+		void setEnabled(bool enabled)
+		{
+			m_enabled = enabled ;
+		}
+
+		/// \brief	Are the statistics enabled?
+		bool enabled() const
+		{
+			return m_enabled ;
+		}
+
+		/// \brief	Adds the counters of the threads to the totals (the threads must not cast rays).
+		void merge()
+		{
+			::std::lock_guard<::std::mutex> lock(m_mutex) ;
+			for(Counters & counters : m_threads)
+			{
+				m_total.add(counters) ;
+				counters.clear() ;
+			}
+		}
+
+		/// \brief	Clears the totals and the counters of the threads (the threads must not cast rays).
+		void reset()
+		{
+			::std::lock_guard<::std::mutex> lock(m_mutex) ;
+			for(Counters & counters : m_threads)
+				counters.clear() ;
+			m_total.clear() ;
+			m_rebuiltHierarchies = -1 ;
+		}
+
+		/// \brief	The totals since the last reset, up to the last merge.
+		Counters const & total() const
+		{
+			return m_total ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	void RayStatistics::print(std::ostream & stream, double seconds) const
+		///
+		/// \brief	Prints the totals: for each type of rays, their number, their throughput and the
+		/// 		average work of their traversal, then the distribution of the path lengths. The update
+		/// 		of the acceleration structures is printed first, if one has been counted.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param [in,out]	stream	The output stream.
+		/// \param	seconds			The rendering time in seconds.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		void print(::std::ostream & stream, double seconds) const
+		{
+			::std::ios::fmtflags flags = stream.flags() ;
+			::std::streamsize precision = stream.precision() ;
+			stream<<::std::fixed<<::std::setprecision(2) ;
+			if(m_rebuiltHierarchies>=0)
+			{
+				stream<<"Hierarchies: "<<m_rebuiltHierarchies<<" rebuilt, "<<m_refittedHierarchies<<" refitted, SAH cost "<<m_sceneSahCost<<::std::endl ;
+			}
+			long long rays = 0, nodes = 0, triangles = 0 ;
+			stream<<"Rays:"<<::std::endl ;
+			for(int type=0 ; type<=rayTypeCount ; ++type)
+			{
+				long long typeRays = type<rayTypeCount ? m_total.m_rays[type] : rays ;
+				long long typeNodes = type<rayTypeCount ? m_total.m_nodes[type] : nodes ;
+				long long typeTriangles = type<rayTypeCount ? m_total.m_triangles[type] : triangles ;
+				if(type<rayTypeCount)
+				{
+					rays += typeRays ;
+					nodes += typeNodes ;
+					triangles += typeTriangles ;
+				}
+				double perRay = typeRays>0 ? 1.0/typeRays : 0.0 ;
+				stream<<"  "<<::std::left<<::std::setw(10)<<(type<rayTypeCount ? rayTypeName(type) : "total")<<::std::right
+					<<::std::setw(12)<<typeRays<<" rays "
+					<<::std::setw(9)<<(seconds>0.0 ? typeRays/seconds*1e-6 : 0.0)<<" Mrays/s "
+					<<::std::setw(8)<<typeNodes*perRay<<" nodes/ray "
+					<<::std::setw(8)<<typeTriangles*perRay<<" triangles/ray"<<::std::endl ;
+			}
+			long long paths = 0 ;
+			for(int bin=0 ; bin<s_pathLengthBins ; ++bin)
+				paths += m_total.m_pathLengths[bin] ;
+			stream<<"Path lengths ("<<paths<<" paths):"<<::std::endl ;
+			for(int bin=0 ; bin<s_pathLengthBins && paths>0 ; ++bin)
+			{
+				if(m_total.m_pathLengths[bin]==0)
+					continue ;
+				stream<<"  "<<::std::setw(3)<<bin+1<<(bin+1==s_pathLengthBins ? "+" : " ")<<::std::setw(7)<<100.0*m_total.m_pathLengths[bin]/paths<<"% "
+					<<::std::string((size_t)(50*m_total.m_pathLengths[bin]/paths), '#')<<::std::endl ;
+			}
+			stream.flags(flags) ;
+			stream.precision(precision) ;
+		}
+	} ;
+}
+
+#endif
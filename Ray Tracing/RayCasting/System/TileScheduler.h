@@ -0,0 +1,185 @@
+#ifndef _System_TileScheduler_H
+#define _System_TileScheduler_H
+
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace System
+{
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// \class	TileScheduler
+	///
+	/// \brief	Distributes the tiles of an image among threads. Tiles are sorted in Morton order and
+	/// 		split in contiguous runs, one per thread, so that each thread starts on a compact region
+	/// 		of the image. A thread takes tiles from the front of its own queue; once its queue is empty,
+	/// 		it steals tiles from the back of the queues of the other threads, so that threads rendering
+	/// 		cheap regions help the ones rendering expensive regions.
+	///
+	/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+	/// \date	16/10/2026
+	////////////////////////////////////////////////////////////////////////////////////////////////////
+	class TileScheduler
+	{
+	public:
+		/// \brief	A rectangle of pixels [x0;x1[ x [y0;y1[.
+		struct Tile
+		{
+			int x0, y0, x1, y1 ;
+		} ;
+
+	protected:
+		/// \brief	The queue of tiles of a thread.
+		struct Queue
+		{
+			::std::mutex m_mutex ;
+			::std::deque<int> m_tiles ;
+		} ;
+
+		/// \brief	The tiles in Morton order.
+		::std::vector<Tile> m_tiles ;
+
+		/// \brief	Interleaves the bits of x and y (Morton code).
+		static unsigned int morton(unsigned int x, unsigned int y)
+		{
+			unsigned int result = 0 ;
+			for(int bit=0 ; bit<16 ; ++bit)
+			{
+				result |= ((x>>bit)&1)<<(2*bit) ;
+				result |= ((y>>bit)&1)<<(2*bit+1) ;
+			}
+			return result ;
+		}
+
+		/// \brief	Takes a tile from the front of the queue of thread or from the back of another queue.
+		static bool next(::std::vector<Queue> & queues, int thread, int & tile)
+		{
+			for(int cpt=0 ; cpt<(int)queues.size() ; ++cpt)
+			{
+				Queue & queue = queues[(thread+cpt)%queues.size()] ;
+				::std::lock_guard<::std::mutex> lock(queue.m_mutex) ;
+				if(queue.m_tiles.empty())
+				{
+					continue ;
+				}
+				if(cpt==0)
+				{
+					tile = queue.m_tiles.front() ;
+					queue.m_tiles.pop_front() ;
+				}
+				else
+				{
+					tile = queue.m_tiles.back() ;
+					queue.m_tiles.pop_back() ;
+				}
+				return true ;
+			}
+			return false ;
+		}
+
+	public:
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	TileScheduler::TileScheduler(int width, int height, int tileSize)
+		///
+		/// \brief	Constructor.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	width   	The width of the image.
+		/// \param	height  	The height of the image.
+		/// \param	tileSize	The size of the (square) tiles.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		TileScheduler(int width, int height, int tileSize)
+		{
+			::std::vector<::std::pair<unsigned int, Tile> > tiles ;
+			for(int y=0 ; y<height ; y+=tileSize)
+			{
+				for(int x=0 ; x<width ; x+=tileSize)
+				{
+					Tile tile = { x, y, ::std::min(x+tileSize, width), ::std::min(y+tileSize, height) } ;
+					tiles.push_back(::std::make_pair(morton(x/tileSize, y/tileSize), tile)) ;
+				}
+			}
+			::std::sort(tiles.begin(), tiles.end(), [](::std::pair<unsigned int, Tile> const & a, ::std::pair<unsigned int, Tile> const & b) { return a.first<b.first ; }) ;
+			for(int cpt=0 ; cpt<(int)tiles.size() ; ++cpt)
+			{
+				m_tiles.push_back(tiles[cpt].second) ;
+			}
+		}
+
+		/// \brief	The tiles in Morton order.
+		const ::std::vector<Tile> & tiles() const
+		{ return m_tiles ; }
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	template <class Function> void TileScheduler::run(int threadCount, Function const & function)
+		///
+		/// \brief	Calls function(tile) once for each tile with threadCount threads.
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	threadCount	The number of threads (0 uses the OpenMP default, ignored without OpenMP).
+		/// \param	function   	The function rendering a tile, called concurrently.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		template <class Function>
+		void run(int threadCount, Function const & function) const
+		{
+			run(threadCount, []() { return 0 ; }, [&](int, Tile const & tile) { function(tile) ; }) ;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// \fn	template <class Create, class Function> void TileScheduler::run(int threadCount, Create const & create, Function const & function)
+		///
+		/// \brief	Calls function(state, tile) once for each tile with threadCount threads, state being
+		/// 		the value returned by create(), called once by each thread before its first tile (for
+		/// 		instance a sampler reused by all the tiles of the thread).
+		///
+		/// \author	L. Foucault & V. Goupoil, Université de Rennes 1
+		/// \date	16/10/2026
+		///
+		/// \param	threadCount	The number of threads (0 uses the OpenMP default, ignored without OpenMP).
+		/// \param	create	   	The function creating the state of a thread, called concurrently.
+		/// \param	function   	The function rendering a tile, called concurrently.
+		////////////////////////////////////////////////////////////////////////////////////////////////////
+		template <class Create, class Function>
+		void run(int threadCount, Create const & create, Function const & function) const
+		{
+#ifdef _OPENMP
+			if(threadCount<=0)
+			{
+				threadCount = omp_get_max_threads() ;
+			}
+#else
+			threadCount = 1 ;
+#endif
+			::std::vector<Queue> queues(threadCount) ;
+			for(int cpt=0 ; cpt<(int)m_tiles.size() ; ++cpt)
+			{
+				queues[(long long)cpt*threadCount/m_tiles.size()].m_tiles.push_back(cpt) ;
+			}
+			// Threads that are not created leave their queue to the others
+#pragma omp parallel num_threads(threadCount)
+			{
+#ifdef _OPENMP
+				int thread = omp_get_thread_num() ;
+#else
+				int thread = 0 ;
+#endif
+				auto state = create() ;
+				int tile ;
+				while(next(queues, thread, tile))
+				{
+					function(state, m_tiles[tile]) ;
+				}
+			}
+		}
+	} ;
+}
+
+#endif
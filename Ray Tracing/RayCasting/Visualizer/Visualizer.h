@@ -15,7 +15,7 @@ namespace Visualizer
 	///
 	/// \brief	Opens a 2D rendering context.
 	///
-	/// \author	F. Lamarche, Universit de Rennes 1
+	/// \author	F. Lamarche, Université de Rennes 1
 	/// \date	03/12/2013
 	////////////////////////////////////////////////////////////////////////////////////////////////////
 	class Visualizer
@@ -34,7 +34,7 @@ namespace Visualizer
 		///
 		/// \brief	Gets flags for SDL draw configuration.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		///
 		/// \param	flags 	The flags.
@@ -75,7 +75,7 @@ namespace Visualizer
 		///
 		/// \brief	Constructor.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		///
 		/// \param	width 	The width of the rendering window.
@@ -110,7 +110,7 @@ namespace Visualizer
 		///
 		/// \brief	Gets the width of the rendering window.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		///
 		/// \return	.
@@ -123,7 +123,7 @@ namespace Visualizer
 		///
 		/// \brief	Gets the height of the rendering window.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		///
 		/// \return	.
@@ -137,7 +137,7 @@ namespace Visualizer
 		///
 		/// \brief	Change the color of a given pixel.
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		///
 		/// \param	x	The x coordinate of the pixel.
@@ -157,7 +157,7 @@ namespace Visualizer
 		///
 		/// \brief	Plots with a simple tone mapper
 		///
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	04/12/2013
 		///
 		/// \param	x	 	The x coordinate.
@@ -183,7 +183,7 @@ namespace Visualizer
 		/// \warning No modification is visible until this method is called. Application exists if any
 		/// 		 key is pressed.
 		/// 
-		/// \author	F. Lamarche, Universit de Rennes 1
+		/// \author	F. Lamarche, Université de Rennes 1
 		/// \date	03/12/2013
 		////////////////////////////////////////////////////////////////////////////////////////////////////
 		void update()